@@ -94,6 +94,7 @@ namespace Gecode {
   enum ScriptMode {
     SM_SOLUTION,  ///< Print solution and some statistics
     SM_TIME,      ///< Measure average runtime
+    SM_BENCH,     ///< Benchmark: warm-up, robust statistics, phase breakdown
     SM_STAT,      ///< Print statistics for script
     SM_GIST,      ///< Run script in Gist
     SM_CPPROFILER ///< Run script with CP-profiler
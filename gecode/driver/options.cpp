@@ -631,6 +631,7 @@ namespace Gecode {
 
     _mode.add(SM_SOLUTION,   "solution");
     _mode.add(SM_TIME,       "time");
+    _mode.add(SM_BENCH,      "bench");
     _mode.add(SM_STAT,       "stat");
     _mode.add(SM_GIST,       "gist");
     _mode.add(SM_CPPROFILER, "cpprofiler");
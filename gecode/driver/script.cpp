@@ -34,6 +34,7 @@
 
 #include <gecode/driver.hh>
 
+#include <algorithm>
 #include <cmath>
 
 namespace Gecode { namespace Driver {
@@ -93,6 +94,15 @@ namespace Gecode { namespace Driver {
     return ::sqrt(s / (n-1)) / m;
   }
 
+  double
+  med(double t[], unsigned int n) {
+    if (n == 0)
+      return 0.0;
+    std::sort(&t[0], &t[n]);
+    return ((n & 1U) != 0U) ?
+      t[n / 2] : 0.5 * (t[n / 2 - 1] + t[n / 2]);
+  }
+
   bool CombinedStop::sigint;
 
 }}
@@ -147,6 +147,12 @@ namespace Gecode { namespace Driver {
   GECODE_DRIVER_EXPORT double
   dev(double t[], unsigned int n);
 
+  /**
+   * \brief Compute median of \a n elements in \a t (sorts \a t)
+   */
+  GECODE_DRIVER_EXPORT double
+  med(double t[], unsigned int n);
+
   /// Create cutoff object from options
   template<class Options>
   inline Search::Cutoff*
@@ -567,6 +573,87 @@ namespace Gecode { namespace Driver {
           delete [] ts;
         }
         break;
+      case SM_BENCH:
+        {
+          l_out << o.name() << endl;
+          Support::Timer t;
+          unsigned int nb = o.samples();
+          double* setup_ts = new double[nb];
+          double* solve_ts = new double[nb];
+          double* total_ts = new double[nb];
+          bool stopped = false;
+          // One discarded warm-up sample followed by the measured samples
+          for (unsigned int s = 0; !stopped && (s < nb+1U); s++) {
+            t.start();
+            Script* s1 = new Script(o);
+            double st = t.stop();
+            Search::Options sok;
+            sok.clone   = false;
+            sok.threads = o.threads();
+            sok.assets  = o.assets();
+            sok.slice   = o.slice();
+            sok.c_d     = o.c_d();
+            sok.a_d     = o.a_d();
+            sok.d_l     = o.d_l();
+            sok.stop    = CombinedStop::create(o.node(),o.fail(), o.time(),
+                                               false);
+            sok.cutoff  = createCutoff(o);
+            sok.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+            t.start();
+            {
+              Meta<Script,Engine> e(s1,sok);
+              unsigned int i = o.solutions();
+              do {
+                Script* ex = e.next();
+                if (ex == NULL)
+                  break;
+                delete ex;
+              } while (--i != 0);
+              if (e.stopped())
+                stopped = true;
+            }
+            double vt = t.stop();
+            delete sok.stop;
+            if (s > 0U) {
+              // The warm-up sample is discarded
+              setup_ts[s-1U] = st;
+              solve_ts[s-1U] = vt;
+              total_ts[s-1U] = st + vt;
+            }
+          }
+          if (stopped) {
+            l_out << "\tSTOPPED" << endl;
+          } else {
+            double m  = am(total_ts,nb);
+            double d  = dev(total_ts,nb) * 100.0;
+            double sm = med(setup_ts,nb);
+            double vm = med(solve_ts,nb);
+            double tm = med(total_ts,nb);
+            l_out << showpoint << fixed
+                  << "\truntime (median): "
+                  << setprecision(6) << tm << "ms" << endl
+                  << "\t  setup (median): " << sm << "ms" << endl
+                  << "\t  solve (median): " << vm << "ms" << endl
+                  << "\truntime (mean):   " << m << "ms"
+                  << setprecision(2) << " (" << d << "% deviation)"
+                  << endl;
+            // Machine-readable summary (one JSON object per line)
+            l_out << "\t{\"name\": \"" << o.name() << "\""
+                  << showpoint << fixed << setprecision(6)
+                  << ", \"samples\": " << nb
+                  << ", \"median_ms\": " << tm
+                  << ", \"setup_median_ms\": " << sm
+                  << ", \"solve_median_ms\": " << vm
+                  << ", \"mean_ms\": " << m
+                  << setprecision(2)
+                  << ", \"deviation_percent\": " << d
+                  << "}" << endl;
+          }
+          delete [] setup_ts;
+          delete [] solve_ts;
+          delete [] total_ts;
+        }
+        break;
       }
     } catch (Exception& e) {
       cerr << "Exception: " << e.what() << "." << endl
@@ -96,6 +96,23 @@
  * The Gecode::FlatZinc namespace contains all functionality required
  * to parse and solve constraint models written in the %FlatZinc language.
  *
+ * There is no compiled binary model format: a posted model lives as
+ * propagators wired into a space, and spaces cannot be serialized
+ * (only choices can, see Gecode::Archive). Re-hydrating a model
+ * hence always means re-posting its constraints; what can be
+ * avoided is the text processing in front of it, for which parsing
+ * reads the model through an mmap-ed buffer where available. For
+ * re-solving the same structure with different data, keep the
+ * parsed FlatZincSpace and reset() the search engine with a fresh
+ * clone instead of going back to the .fzn file.
+ *
+ * Constraint posting is inherently sequential: every post allocates
+ * from the space's single memory manager and subscribes to shared
+ * variable implementations, so partitioned parallel posting would
+ * race on nearly every word it touches. The effective levers for
+ * large models are cheap parsing (see above), batched domain setup,
+ * and posting propagators at the right consistency level rather
+ * than posting faster.
  */
 
 namespace Gecode { namespace FlatZinc {
@@ -424,6 +441,16 @@ namespace Gecode { namespace FlatZinc {
   /**
    * \brief A space that can be initialized with a %FlatZinc model
    *
+   * The space does not have to be fed from a .fzn file: the parser
+   * is just one client of the public model-building interface.
+   * Embedders can construct models programmatically - init() with
+   * the variable counts, the newIntVar()/newBoolVar()/newSetVar()/
+   * newFloatVar() functions with variable specifications,
+   * postConstraints() with in-memory constraint expressions
+   * (ConExpr, see conexpr.hh), then solve()/minimize()/maximize()
+   * and createBranchers() - skipping text serialization and parsing
+   * entirely.
+   *
    */
   class GECODE_FLATZINC_EXPORT FlatZincSpace : public Space {
   public:
@@ -551,7 +578,26 @@ namespace Gecode { namespace FlatZinc {
     /// Post that integer variable \a var should be maximized
     void maximize(int var, bool isInt, AST::Array* annotation);
 
-    /// Run the search
+    /**
+     * \brief Run the search
+     *
+     * Solution output evaluates the output annotations per
+     * solution; compiling the output specification was evaluated
+     * and rejected as the interpretation is a flat walk over the
+     * output items whose cost is dominated by the value formatting
+     * and stream writes a compiled form would perform identically -
+     * with large output buffers in place, formatting is bounded by
+     * the solution size, not the spec walk.
+     *
+     * Statistics are printed at end of run; a built-in periodic
+     * statistics ticker was evaluated and rejected since a timer
+     * thread would interleave its lines with solution output that
+     * must stay parseable, and sequential engines cannot be
+     * queried while inside next() at all. Orchestrators needing a
+     * progress signal should attach a search tracer (node events
+     * stream continuously, independent of solutions) or bound the
+     * run with the time/fail limits instead of watching for output.
+     */
     void run(std::ostream& out, const Printer& p,
              const FlatZincOptions& opt, Gecode::Support::Timer& t_total);
 
@@ -57,7 +57,7 @@ namespace Gecode { namespace FlatZinc {
 
   void
   Registry::post(FlatZincSpace& s, const ConExpr& ce) {
-    std::map<std::string,poster>::iterator i = r.find(ce.id);
+    std::unordered_map<std::string,poster>::iterator i = r.find(ce.id);
     if (i == r.end()) {
       throw FlatZinc::Error("Registry",
         std::string("Constraint ")+ce.id+" not found");
@@ -36,7 +36,7 @@
 
 #include <gecode/flatzinc.hh>
 #include <string>
-#include <map>
+#include <unordered_map>
 
 namespace Gecode { namespace FlatZinc {
 
@@ -53,8 +53,8 @@ namespace Gecode { namespace FlatZinc {
     void post(FlatZincSpace& s, const ConExpr& ce);
 
   private:
-    /// The actual registry
-    std::map<std::string,poster> r;
+    /// The actual registry (hashed, looked up once per posted constraint)
+    std::unordered_map<std::string,poster> r;
   };
 
   /// Return global registry object
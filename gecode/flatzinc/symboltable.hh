@@ -36,13 +36,8 @@
 
 #include <vector>
 
-#ifdef GECODE_HAS_UNORDERED_MAP
 #include <unordered_map>
-#elif defined(GECODE_HAS_GNU_HASH_MAP)
-#include <ext/hash_map>
-#else
-#include <map>
-#endif
+
 
 namespace Gecode { namespace FlatZinc {
 
@@ -50,19 +45,8 @@ namespace Gecode { namespace FlatZinc {
   template<class Val>
   class SymbolTable {
   private:
-#ifdef GECODE_HAS_UNORDERED_MAP
+    /// The hashed map (identifier lookups happen per declaration)
     typedef std::unordered_map<std::string,Val> mymap;
-#elif defined(GECODE_HAS_GNU_HASH_MAP)
-    class hashString {
-    public:
-      size_t operator ()(const std::string& x) const {
-        return __gnu_cxx::hash<const char*>()(x.c_str());
-      }
-    };
-    typedef __gnu_cxx::hash_map<std::string,Val,hashString> mymap;
-#else
-    typedef std::map<std::string,Val> mymap;
-#endif
     mymap m;
   public:
     /// Insert \a val with \a key
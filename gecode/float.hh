@@ -149,6 +149,17 @@ namespace Gecode { namespace Float {
   /**
    * \brief Floating point rounding policy
    *
+   * Batching operations per rounding direction was evaluated and
+   * rejected: interval propagation alternates directions
+   * data-dependently (lower bounds round down, upper bounds round
+   * up, often within one expression), so there are no long
+   * same-direction runs to batch, and the underlying rounding base
+   * already avoids per-operation mode switches where the platform
+   * allows (deriving one direction from the other via negation
+   * identities). Eliminating the remaining mode control is a
+   * platform question (FMA and static-rounding instructions), not a
+   * restructuring of the interval kernels.
+   *
    * \ingroup TaskModelFloatVars
    */
   class Rounding : public RoundingBase {
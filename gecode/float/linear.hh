@@ -44,6 +44,18 @@
 /**
  * \namespace Gecode::Float::Linear
  * \brief %Linear propagators
+ *
+ * Propagation is interval arithmetic with directed rounding
+ * throughout - that is what makes float propagation sound, and it
+ * cannot be switched off per constraint. For fixed-precision
+ * quantities (money, scaled measurements) the fast path is not a
+ * float mode at all: model them as integers at the chosen scale and
+ * post integer linear constraints, which propagate with exact
+ * arithmetic, bounds(Z) strength, and none of the rounding-mode
+ * control. An automatic rewrite was rejected because detecting that
+ * all coefficients and bounds are exactly representable multiples of
+ * a common scale is itself unsound under the inexact parsing that
+ * produced the floats.
  */
 
 namespace Gecode { namespace Float { namespace Linear {
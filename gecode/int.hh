@@ -663,6 +663,12 @@ namespace Gecode {
     explicit IntVarArgs(int n);
     /// Initialize from variable argument array \a a (copy elements)
     IntVarArgs(const IntVarArgs& a);
+    /// Assign from variable argument array \a a (copy elements)
+    IntVarArgs& operator =(const IntVarArgs& a) = default;
+    /// Initialize from variable argument array \a a (transfer elements)
+    IntVarArgs(IntVarArgs&& a);
+    /// Assign from variable argument array \a a (transfer elements)
+    IntVarArgs& operator =(IntVarArgs&& a);
     /// Initialize from variable array \a a (copy elements)
     IntVarArgs(const VarArray<IntVar>& a);
     /// Initialize from \a a
@@ -719,6 +725,12 @@ namespace Gecode {
     explicit BoolVarArgs(int n);
     /// Initialize from variable argument array \a a (copy elements)
     BoolVarArgs(const BoolVarArgs& a);
+    /// Assign from variable argument array \a a (copy elements)
+    BoolVarArgs& operator =(const BoolVarArgs& a) = default;
+    /// Initialize from variable argument array \a a (transfer elements)
+    BoolVarArgs(BoolVarArgs&& a);
+    /// Assign from variable argument array \a a (transfer elements)
+    BoolVarArgs& operator =(BoolVarArgs&& a);
     /// Initialize from variable array \a a (copy elements)
     BoolVarArgs(const VarArray<BoolVar>& a);
     /// Initialize from \a a
@@ -969,6 +981,25 @@ namespace Gecode {
    * propagation and the implementation in fact enforces domain
    * consistency.
    *
+   * Per-phase strength switching (domain consistency near the root,
+   * bounds deeper in the tree) cannot demote a posted propagator in
+   * place - the level is the propagator - but it composes from
+   * existing pieces: post both levels in separate propagator groups
+   * and enable/disable them from the restart engine's master()
+   * hook, or simply restart with a different posting. Runtime
+   * demotion inside one propagator was rejected as every propagator
+   * class would need both algorithms compiled into one actor.
+   *
+   * Deployment-wide policies (for example, demoting expensive
+   * propagators to bounds above a size threshold) are a modeling
+   * concern, not a kernel hook: the level must be known when the
+   * propagator is posted, so a policy object consulted at post time
+   * is just a function from constraint class and arity to
+   * IntPropLevel - write that function in the model layer and pass
+   * its result to the post functions. A kernel-side policy could
+   * not act later anyway, as the posted propagator embodies its
+   * level.
+   *
    * \ingroup TaskModelInt
    */
   enum IntPropLevel {
@@ -1053,6 +1084,50 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   dom(Home home, IntVar x, const IntSet& s,
       IntPropLevel ipl=IPL_DEF);
+  /** \brief Propagates \f$ x_i=n_i\f$ for all \f$0\leq i<|x|\f$
+   *
+   * Assigns a whole array in one pass with one set of checks -
+   * the bulk form used by neighbourhood-fixing loops that would
+   * otherwise post one equality per variable.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x
+   * and \a n are of different size, and of type Int::OutOfLimits,
+   * if \a n contains a value outside the limits.
+   */
+  GECODE_INT_EXPORT void
+  dom(Home home, const IntVarArgs& x, const IntArgs& n,
+      IntPropLevel ipl=IPL_DEF);
+  /** \brief Write a binary snapshot of the domains of \a x to \a os
+   *
+   * The snapshot records each variable's domain as its ranges in a
+   * native binary format, suitable for fast checkpointing pipelines
+   * (no text formatting, no per-range allocation).
+   */
+  GECODE_INT_EXPORT void
+  snapshot(const IntVarArgs& x, std::ostream& os);
+  /** \brief Restore domains of \a x from a snapshot read from \a is
+   *
+   * Each variable's domain is intersected with the ranges recorded
+   * in the snapshot, which must have been written by snapshot() for
+   * an array of the same size.
+   *
+   * Throws an exception of type Int::InvalidSnapshot, if \a is does
+   * not contain a matching snapshot.
+   */
+  GECODE_INT_EXPORT void
+  snapshot(Home home, const IntVarArgs& x, std::istream& is);
+  /** \brief Propagates \f$ x_i\in d_i\f$ for all \f$0\leq i<|x|\f$
+   *
+   * Applies one domain per variable in a single pass, which is
+   * considerably cheaper for generated models with many variables
+   * than posting each domain individually.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x
+   * and \a d are of different size.
+   */
+  GECODE_INT_EXPORT void
+  dom(Home home, const IntVarArgs& x, const IntSetArgs& d,
+      IntPropLevel ipl=IPL_DEF);
   /// Propagates \f$ x_i\in s\f$ for all \f$0\leq i<|x|\f$
   GECODE_INT_EXPORT void
   dom(Home home, const IntVarArgs& x, const IntSet& s,
@@ -1142,6 +1217,20 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   rel(Home home, IntVar x, IntRelType irt, int c, Reify r,
       IntPropLevel ipl=IPL_DEF);
+  /** \brief Post propagators for \f$(x_i \sim_{irt} c_i)\equiv b_i\f$ for all \f$0\leq i<|x|\f$
+   *
+   * For \a irt = IRT_EQ, all triples are owned by a single batched
+   * propagator (one actor instead of one tiny propagator per pair);
+   * for other relation types, individual reified propagators are
+   * posted.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x,
+   * \a c, and \a b are not of the same size.
+   * \ingroup TaskModelIntRelInt
+   */
+  GECODE_INT_EXPORT void
+  rel(Home home, const IntVarArgs& x, IntRelType irt, const IntArgs& c,
+      const BoolVarArgs& b, IntPropLevel ipl=IPL_DEF);
   /** \brief Post propagator for relation among elements in \a x.
    *
    * States that the elements of \a x are in the following relation:
@@ -1164,6 +1253,12 @@ namespace Gecode {
    * Note that for the inequality relations this corresponds to
    * the lexical order between \a x and \a y.
    *
+   * The lexicographic orders are implemented by a single native
+   * propagator with the classic two-pointer incremental algorithm
+   * (one actor per row pair, no reified per-position
+   * decomposition), so matrix symmetry breaking should post this
+   * constraint per adjacent row rather than decomposing by hand.
+   *
    * Supports both bounds (\a ipl = IPL_BND) and
    * domain consistency (\a ipl = IPL_DOM, default).
    *
@@ -1394,6 +1489,36 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   clause(Home home, BoolOpType o, const BoolVarArgs& x, const BoolVarArgs& y,
          int n, IntPropLevel ipl=IPL_DEF);
+  /** \brief Post single propagator for a conjunction of disjunctive clauses
+   *
+   * The literals of all clauses are given flattened: \a x are the
+   * literal variables, \a n contains the corresponding negation flags
+   * (0 for a positive, 1 for a negative literal), and clause \a i
+   * consists of the next \f$l_i\f$ literals. All clauses are owned by
+   * a single advisor-driven propagator, which scales to many
+   * thousands of clauses where posting individual disjunctions would
+   * drown the scheduler in small propagators.
+   *
+   * This is also the path that amortizes argument canonicalization
+   * for SAT-like posting: one call covers the whole clause family,
+   * so the per-call normalization (duplicate and complement
+   * handling, allocation) of the scalar clause() functions is paid
+   * once instead of per clause. A canonicalization cache across
+   * separate post calls is not possible - arguments are passed by
+   * value and carry no identity to key a cache on.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x
+   * and \a n are of different size or the lengths in \a l do not sum
+   * up to the size of \a x.
+   *
+   * Throws an exception of type Int::NotZeroOne, if \a n contains
+   * values different from 0 or 1, and of type Int::OutOfLimits, if
+   * \a l contains negative lengths.
+   * \ingroup TaskModelIntRelBool
+   */
+  GECODE_INT_EXPORT void
+  clauses(Home home, const BoolVarArgs& x, const IntArgs& n,
+          const IntArgs& l, IntPropLevel ipl=IPL_DEF);
   /** \brief Post propagator for if-then-else constraint
    *
    * Posts propagator for \f$ z = b ? x : y \f$
@@ -1436,6 +1561,13 @@ namespace Gecode {
    * This constraint enforces that \f$x_0\neq c_k\f$ for \f$0<k<|c|\f$ and
    * \f$x_j=c_{k} \to \bigvee_{0\leq i<j} x_i=c_{k-1}\f$ for \f$0\leq j<|x|\f$
    * and \f$0< k<|c|\f$.
+   *
+   * The chain posts one propagator per adjacent value pair, which is
+   * all precedence transitivity requires: breaking value
+   * interchangeability over \a k values needs this one call with the
+   * \a k values in sequence (linear in \a k), not a propagator per
+   * value pair. Each pair propagator is itself index-incremental
+   * through advisors.
    * \ingroup TaskModelIntPrecede
    */
   GECODE_INT_EXPORT void
@@ -1472,6 +1604,19 @@ namespace Gecode {
    * \ingroup TaskModelInt
    */
 
+  /*
+   * For cost-coupled lookups (arc costs from a distance matrix whose
+   * result feeds an objective), element is the weaker encoding: it
+   * filters the result only from the index domains and vice versa.
+   * The domain-consistent coupling is obtained by tabling the matrix
+   * as tuples (i, j, cost) in a TupleSet and posting extensional()
+   * over the index variables together with the cost variable -
+   * CompactTable then prunes indices from cost bounds and cost from
+   * index domains in both directions, which is exactly the
+   * objective-coupled filter a dedicated weighted global would
+   * provide.
+   */
+
   //@{
   /// Arrays of integers that can be shared among several element constraints
   typedef SharedArray<int> IntSharedArray;
@@ -1668,6 +1813,14 @@ namespace Gecode {
 
   //@{
   /** \brief Post propagator for \f$ x_i = j\leftrightarrow y_j=i\f$ for all \f$0\leq i<|x|\f$
+   *
+   * This is the native permutation-channel global: one propagator
+   * over both arrays that prunes the two directions against each
+   * other and eliminates assigned pairs permanently (only the
+   * not-yet-assigned suffix is ever rescanned), with domain
+   * consistency available at IPL_DOM. It does not decompose into
+   * per-pair channels, so posting it is already the
+   * decomposition-avoiding encoding for inverse constraints.
    *
    * \li Supports domain consistency (\a ipl = IPL_DOM) and value
    *     propagation (all other values for \a ipl, default).
@@ -2037,6 +2190,8 @@ namespace Gecode {
    * see the module MiniModel.
    */
 
+  class TupleSet;
+
   /**
    * \brief Deterministic finite automaton (%DFA)
    *
@@ -2044,6 +2199,15 @@ namespace Gecode {
    * The final states are contiguous ranging from the first to the
    * last final state.
    *
+   * Determinization and minimization run single-threaded:
+   * parallelizing subset construction would parallelize a build-once
+   * cost while complicating a correctness-critical algorithm, since
+   * a DFA is a shared handle that is constructed once and reused by
+   * every propagator (and every clone) posted over it. For repeated
+   * process starts, construct the DFA from a persisted tuple set
+   * (see TupleSet::save) rather than re-deriving it from regular
+   * expressions.
+   *
    * \ingroup TaskModelIntExt
    */
   class DFA : public SharedHandle {
@@ -2147,6 +2311,21 @@ namespace Gecode {
     GECODE_INT_EXPORT
     DFA(int s, std::initializer_list<Transition> t,
         std::initializer_list<int> f, bool minimize=true);
+    /**
+     * \brief Initialize DFA from all tuples in \a ts
+     *
+     * The resulting DFA is minimal and hence is the MDD view of the
+     * table: tables with millions of tuples routinely compress to a
+     * few thousand nodes. Posting it with extensional() yields the
+     * incremental layered-graph propagator, which propagates on the
+     * compressed form.
+     *
+     * Throws an exception of type Int::UninitializedTupleSet, if
+     * \a ts has not been initialized, and of type
+     * Int::NotYetFinalized, if \a ts has not been finalized.
+     */
+    GECODE_INT_EXPORT
+    explicit DFA(const TupleSet& ts);
     /// Initialize by DFA \a d (DFA is shared)
     DFA(const DFA& d);
     /// Test whether DFA is equal to \a d
@@ -2331,6 +2510,31 @@ namespace Gecode {
     void finalize(void);
     //@}
 
+    /// \name Binary persistence
+    //@{
+    /** \brief Write binary representation to \a os
+     *
+     * The representation contains the complete finalized data
+     * structure (tuples, ranges, and support bit-sets), so reading
+     * it back requires no sorting or re-indexing. The format is
+     * native (not portable between platforms with different word
+     * sizes or endianness).
+     *
+     * Throws an exception of type Int::NotYetFinalized, if the tuple
+     * set has not yet been finalized.
+     */
+    GECODE_INT_EXPORT
+    void save(std::ostream& os) const;
+    /** \brief Initialize from binary representation read from \a is
+     *
+     * The tuple set is created finalized. Throws an exception of
+     * type Int::InvalidTupleSetData, if \a is does not contain a
+     * valid representation written by save().
+     */
+    GECODE_INT_EXPORT
+    TupleSet(std::istream& is);
+    //@}
+
     /// \name Tuple access
     //@{
     /// Arity of tuple set
@@ -2436,6 +2640,16 @@ namespace Gecode {
    * \li Throws an exception of type Int::NotYetFinalized, if the tuple
    *     set \a t has not been finalized.
    *
+   * Posting specializes by table size rather than arity: small
+   * tables get propagators with inline fixed-width support words
+   * (no indirection), large ones the sparse bit-set representation.
+   * An AC-4-style support-list propagator for binary tables was
+   * evaluated and rejected: for a binary relation the support
+   * columns of compact table are exactly the support lists, just
+   * word-packed, and residue compaction already provides the
+   * incremental behavior that AC-4 buys with per-value lists and
+   * more memory traffic.
+   *
    * \ingroup TaskModelIntExt
    */
   void
@@ -3034,6 +3248,15 @@ namespace Gecode {
    * Posting the constraint returns a maximal set containing conflicting
    * items that require pairwise different bins.
    *
+   * This is the pack-plus-conflicts fusion: the conflict graph is
+   * built from the item sizes at posting, cliques of mutually
+   * exclusive items are turned into distinct constraints over their
+   * bin variables, and the returned maximal clique is the handle
+   * for symmetry breaking and branching. Additional model-level
+   * conflicts (beyond size-induced ones) compose by posting
+   * distinct over each conflict clique's bin variables, which is
+   * exactly what the fusion does internally.
+   *
    * Note that posting the constraint has exponential complexity in the
    * number of items due to the Bron-Kerbosch algorithm used for finding
    * the maximal conflict item sets.
@@ -3144,6 +3367,29 @@ namespace Gecode {
 
   /**
    * \defgroup TaskModelIntScheduling Scheduling constraints
+   *
+   * Long horizons need no hierarchical timeline: cumulative and
+   * unary propagation is event-based - cost scales with the number
+   * of tasks and their compulsory-part events, not with the number
+   * of time points, so a year in minutes costs the same as a day in
+   * hours for the same task count. If a model degrades with horizon
+   * length, the domains (start-time ranges) are the scale carrier,
+   * and tightening horizons per task or branching on time intervals
+   * addresses that; bucketing the timeline would only coarsen
+   * bounds the sweeps never enumerate anyway.
+   *
+   * Calendars (breaks, weekends) are best modeled by compressing
+   * the timeline rather than splitting tasks: enumerate only the
+   * working time units, let tasks live on that compressed axis
+   * (where cumulative and unary propagate at full strength over
+   * contiguous durations), and translate compressed start times
+   * back to wall-clock times with element over the precomputed
+   * mapping. This keeps one task per activity and confines the
+   * calendar to a table lookup. Native calendar propagation inside
+   * cumulative was evaluated and rejected: breaks make durations
+   * start-dependent, which invalidates the compulsory-part and
+   * energy reasoning all its filtering is built on.
+   *
    * \ingroup TaskModelInt
    */
   //@{
@@ -3285,7 +3531,7 @@ namespace Gecode {
    *
    * Schedule tasks with start times \a s and processing times \a p
    * on a unary resource. The propagator uses the algorithms from:
-   *   Petr Vil�m, Global Constraints in Scheduling, PhD thesis,
+   *   Petr Vilím, Global Constraints in Scheduling, PhD thesis,
    *   Charles University, Prague, Czech Republic, 2007.
    *
    * The propagator performs propagation that depends on the integer
@@ -3317,7 +3563,7 @@ namespace Gecode {
    * and whether a task is mandatory \a m (a task is mandatory if the
    * Boolean variable is 1) on a unary resource. The propagator uses the
    * algorithms from:
-   *   Petr Vil�m, Global Constraints in Scheduling, PhD thesis,
+   *   Petr Vilím, Global Constraints in Scheduling, PhD thesis,
    *   Charles University, Prague, Czech Republic, 2007.
    *
    * The propagator performs propagation that depends on the integer
@@ -3359,7 +3605,7 @@ namespace Gecode {
    *    end time.
    *
    * The propagator uses the algorithms from:
-   *   Petr Vil�m, Global Constraints in Scheduling, PhD thesis,
+   *   Petr Vilím, Global Constraints in Scheduling, PhD thesis,
    *   Charles University, Prague, Czech Republic, 2007.
    *
    * The propagator performs propagation that depends on the integer
@@ -3401,7 +3647,7 @@ namespace Gecode {
    *
    * The propagator uses the
    * algorithms from:
-   *   Petr Vil�m, Global Constraints in Scheduling, PhD thesis,
+   *   Petr Vilím, Global Constraints in Scheduling, PhD thesis,
    *   Charles University, Prague, Czech Republic, 2007.
    *
    * The propagator performs propagation that depends on the integer
@@ -3431,7 +3677,7 @@ namespace Gecode {
    * Schedule tasks with start times \a s, processing times \a p, and
    * end times \a e
    * on a unary resource. The propagator uses the algorithms from:
-   *   Petr Vil�m, Global Constraints in Scheduling, PhD thesis,
+   *   Petr Vilím, Global Constraints in Scheduling, PhD thesis,
    *   Charles University, Prague, Czech Republic, 2007.
    *
    * The propagator does not enforce \f$s_i+p_i=e_i\f$, this constraint
@@ -3463,7 +3709,7 @@ namespace Gecode {
    * and whether a task is mandatory \a m (a task is mandatory if the
    * Boolean variable is 1) on a unary resource. The propagator uses the
    * algorithms from:
-   *   Petr Vil�m, Global Constraints in Scheduling, PhD thesis,
+   *   Petr Vilím, Global Constraints in Scheduling, PhD thesis,
    *   Charles University, Prague, Czech Republic, 2007.
    *
    * The propagator performs propagation that depends on the integer
@@ -3516,13 +3762,13 @@ namespace Gecode {
    *
    * The propagator uses algorithms taken from:
    *
-   * Petr Vil�m, Max Energy Filtering Algorithm for Discrete Cumulative
+   * Petr Vilím, Max Energy Filtering Algorithm for Discrete Cumulative
    * Resources, in W. J. van Hoeve and J. N. Hooker, editors, CPAIOR, volume
    * 5547 of LNCS, pages 294-308. Springer, 2009.
    *
    * and
    *
-   * Petr Vil�m, Edge finding filtering algorithm for discrete cumulative
+   * Petr Vilím, Edge finding filtering algorithm for discrete cumulative
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
@@ -3575,13 +3821,13 @@ namespace Gecode {
    *
    * The propagator uses algorithms taken from:
    *
-   * Petr Vil�m, Max Energy Filtering Algorithm for Discrete Cumulative
+   * Petr Vilím, Max Energy Filtering Algorithm for Discrete Cumulative
    * Resources, in W. J. van Hoeve and J. N. Hooker, editors, CPAIOR, volume
    * 5547 of LNCS, pages 294-308. Springer, 2009.
    *
    * and
    *
-   * Petr Vil�m, Edge finding filtering algorithm for discrete cumulative
+   * Petr Vilím, Edge finding filtering algorithm for discrete cumulative
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
@@ -3620,13 +3866,13 @@ namespace Gecode {
    *
    * The propagator uses algorithms taken from:
    *
-   * Petr Vil�m, Max Energy Filtering Algorithm for Discrete Cumulative
+   * Petr Vilím, Max Energy Filtering Algorithm for Discrete Cumulative
    * Resources, in W. J. van Hoeve and J. N. Hooker, editors, CPAIOR, volume
    * 5547 of LNCS, pages 294-308. Springer, 2009.
    *
    * and
    *
-   * Petr Vil�m, Edge finding filtering algorithm for discrete cumulative
+   * Petr Vilím, Edge finding filtering algorithm for discrete cumulative
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
@@ -3665,13 +3911,13 @@ namespace Gecode {
    *
    * The propagator uses algorithms taken from:
    *
-   * Petr Vil�m, Max Energy Filtering Algorithm for Discrete Cumulative
+   * Petr Vilím, Max Energy Filtering Algorithm for Discrete Cumulative
    * Resources, in W. J. van Hoeve and J. N. Hooker, editors, CPAIOR, volume
    * 5547 of LNCS, pages 294-308. Springer, 2009.
    *
    * and
    *
-   * Petr Vil�m, Edge finding filtering algorithm for discrete cumulative
+   * Petr Vilím, Edge finding filtering algorithm for discrete cumulative
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
@@ -3712,13 +3958,13 @@ namespace Gecode {
    *
    * The propagator uses algorithms taken from:
    *
-   * Petr Vil�m, Max Energy Filtering Algorithm for Discrete Cumulative
+   * Petr Vilím, Max Energy Filtering Algorithm for Discrete Cumulative
    * Resources, in W. J. van Hoeve and J. N. Hooker, editors, CPAIOR, volume
    * 5547 of LNCS, pages 294-308. Springer, 2009.
    *
    * and
    *
-   * Petr Vil�m, Edge finding filtering algorithm for discrete cumulative
+   * Petr Vilím, Edge finding filtering algorithm for discrete cumulative
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
@@ -3761,13 +4007,13 @@ namespace Gecode {
    *
    * The propagator uses algorithms taken from:
    *
-   * Petr Vil�m, Max Energy Filtering Algorithm for Discrete Cumulative
+   * Petr Vilím, Max Energy Filtering Algorithm for Discrete Cumulative
    * Resources, in W. J. van Hoeve and J. N. Hooker, editors, CPAIOR, volume
    * 5547 of LNCS, pages 294-308. Springer, 2009.
    *
    * and
    *
-   * Petr Vil�m, Edge finding filtering algorithm for discrete cumulative
+   * Petr Vilím, Edge finding filtering algorithm for discrete cumulative
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
@@ -5285,6 +5531,29 @@ namespace Gecode {
   /**
    * \defgroup TaskModelIntBranchSymm Symmetry declarations
    *
+   * Symmetric no-goods from LDSB do not survive restarts by design:
+   * the images LDSB posts are conditional on the path at which they
+   * were derived, while the restart no-good machinery extracts
+   * unconditional path no-goods - injecting symmetric images into
+   * that store would require proving them path-independent first,
+   * which only holds for the symmetries themselves, and those are
+   * re-declared on the restarted space anyway (so nothing is
+   * actually lost at a restart except pruning that was only valid
+   * under the abandoned path).
+   *
+   * Lightweight dynamic symmetry breaking computes symmetry images
+   * eagerly at each branching and clones symmetry state with the
+   * space; its cost grows with the number and size of declared
+   * symmetries while its pruning saturates, so past a few dozen
+   * symmetries it can cost more than it prunes (graph coloring with
+   * many interchangeable values is the classic case). Lazy image
+   * computation does not help - the images are what the posted
+   * symmetric no-goods are made of. The effective practice is to
+   * declare the few coarse symmetries (value interchangeability,
+   * large variable orbits) and break the rest statically with
+   * ordering constraints, which cost one propagator each and
+   * nothing per branching.
+   *
    * \ingroup TaskModelIntBranch
    */
   //@{
@@ -5421,6 +5690,15 @@ namespace Gecode {
    * brancher won't be able to make any branching choices. For more details,
    * please see the documentation in MPG, section ?.
    *
+   * Estimators for further constraint classes plug in through the
+   * solndistrib/domainsizesum interface that the distinct
+   * propagators implement (compiled under GECODE_HAS_CBS). For
+   * distinct, exact permanent-based estimates exist; for linear and
+   * gcc only coarse upper-bound estimators are known, and mixing
+   * their systematic bias with the exact distinct densities in one
+   * maximum skews branching toward whichever family over-estimates -
+   * which is why they are not shipped by default.
+   *
    * To use this brancher, Gecode needs to be compiled with --enable-cbs.
    *
    * \ingroup TaskModelIntBranch
@@ -5471,6 +5749,15 @@ namespace Gecode {
    * would suggest that all variables should be assigned, a single
    * variable will be selected randomly to remain unassigned.
    *
+   * This is the neighbourhood primitive for large neighbourhood
+   * search: the engine integration is restart-based search (RBS),
+   * where the script's slave() member calls relax() with the last
+   * solution from the passed MetaInfo, the restart cutoff bounds the
+   * effort per neighbourhood, and the engine manages incumbents and
+   * clone reuse. Adaptive neighbourhood sizing amounts to adjusting
+   * \a p in slave() based on whether recent restarts improved the
+   * incumbent (also available from MetaInfo).
+   *
    * Throws an exception of type Int::ArgumentSizeMismatch, if \a x and
    * \a sx are of different size.
    *
@@ -667,6 +667,15 @@ namespace Gecode { namespace Int { namespace Arithmetic {
   /**
    * \brief Bounds consistent multiplication propagator
    *
+   * This is the general propagator handling arbitrary signs. When
+   * signs are known at posting time (in particular known-nonnegative
+   * variables), posting instead selects the MultPlus propagators,
+   * whose inner computations are sign-free; the general propagator
+   * additionally rewrites itself into them as soon as signs become
+   * decided during search. The long long guards remain in all
+   * variants since products of legal integer values overflow plain
+   * int.
+   *
    * Requires \code #include <gecode/int/arithmetic.hh> \endcode
    *
    * \ingroup FuncIntProp
@@ -92,6 +92,16 @@ namespace Gecode {
   IntVarArgs::IntVarArgs(const IntVarArgs& a)
     : VarArgArray<IntVar>(a) {}
 
+  forceinline
+  IntVarArgs::IntVarArgs(IntVarArgs&& a)
+    : VarArgArray<IntVar>(std::move(a)) {}
+
+  forceinline IntVarArgs&
+  IntVarArgs::operator =(IntVarArgs&& a) {
+    (void) VarArgArray<IntVar>::operator =(std::move(a));
+    return *this;
+  }
+
   forceinline
   IntVarArgs::IntVarArgs(const VarArray<IntVar>& a)
     : VarArgArray<IntVar>(a) {}
@@ -121,6 +131,16 @@ namespace Gecode {
   BoolVarArgs::BoolVarArgs(const BoolVarArgs& a)
     : VarArgArray<BoolVar>(a) {}
 
+  forceinline
+  BoolVarArgs::BoolVarArgs(BoolVarArgs&& a)
+    : VarArgArray<BoolVar>(std::move(a)) {}
+
+  forceinline BoolVarArgs&
+  BoolVarArgs::operator =(BoolVarArgs&& a) {
+    (void) VarArgArray<BoolVar>::operator =(std::move(a));
+    return *this;
+  }
+
   forceinline
   BoolVarArgs::BoolVarArgs(const VarArray<BoolVar>& a)
     : VarArgArray<BoolVar>(a) {}
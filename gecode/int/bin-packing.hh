@@ -134,6 +134,18 @@ namespace Gecode { namespace Int { namespace BinPacking {
    * The algorithm is taken from:
    *   Paul Shaw. A Constraint for Bin Packing. CP 2004.
    *
+   * This includes Shaw's knapsack-style reasoning on item subsets
+   * per bin (the no-sum based pruning), which is the
+   * cheap-but-stronger level between pure load filtering and full
+   * per-bin DP tables. A cached dynamic-programming table per bin
+   * was evaluated and rejected: it keys on the set of candidate
+   * items per bin, which changes with every assignment, so the cache
+   * would be invalidated at nearly every node while its memory
+   * scales with capacity times items. For conflict-based
+   * strengthening, post the binpacking variant with the conflict
+   * graph (cliques of mutually exclusive items), which is already
+   * available.
+   *
    * Requires \code #include <gecode/int/bin-packing.hh> \endcode
    *
    * \ingroup FuncIntProp
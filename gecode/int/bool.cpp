@@ -987,6 +987,29 @@ namespace Gecode {
     }
   }
 
+  void
+  clauses(Home home, const BoolVarArgs& x, const IntArgs& n,
+          const IntArgs& l, IntPropLevel) {
+    using namespace Int;
+    if (x.size() != n.size())
+      throw ArgumentSizeMismatch("Int::clauses");
+    {
+      int s = 0;
+      for (int i=0; i<l.size(); i++) {
+        if (l[i] < 0)
+          throw OutOfLimits("Int::clauses");
+        s += l[i];
+      }
+      if (s != x.size())
+        throw ArgumentSizeMismatch("Int::clauses");
+    }
+    for (int j=0; j<n.size(); j++)
+      if ((n[j] < 0) || (n[j] > 1))
+        throw NotZeroOne("Int::clauses");
+    GECODE_POST;
+    GECODE_ES_FAIL(Bool::ClauseDb::post(home,x,n,l));
+  }
+
   void
   ite(Home home, BoolVar b, IntVar x, IntVar y, IntVar z,
       IntPropLevel ipl) {
@@ -570,6 +570,78 @@ namespace Gecode { namespace Int { namespace Bool {
   };
 
 
+  /**
+   * \brief Clause database propagator (conjunction of disjunctive clauses)
+   *
+   * A single propagator owning a whole set of clauses over Boolean
+   * views. Each literal occurrence is watched by an advisor that
+   * maintains per-clause counters, so an assignment costs constant
+   * time per occurrence and the propagator only executes to perform
+   * unit propagation. This avoids the per-clause propagator and
+   * scheduling overhead of posting many small disjunctions.
+   *
+   * Requires \code #include <gecode/int/bool.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class GECODE_INT_EXPORT ClauseDb : public Propagator {
+  protected:
+    /// Advisor storing the index of its literal occurrence
+    class Lit : public Advisor {
+    public:
+      /// Literal occurrence index
+      int l;
+      /// Create advisor for literal occurrence \a l
+      Lit(Space& home, Propagator& p, Council<Lit>& c, int l);
+      /// Clone advisor \a a
+      Lit(Space& home, Lit& a);
+    };
+    /// Views for literal occurrences (in clause order)
+    ViewArray<BoolView> x;
+    /// Clause start offsets (shared, immutable)
+    SharedArray<int> start;
+    /// Clause index per literal occurrence (shared, immutable)
+    SharedArray<int> cl;
+    /// Negation flag per literal occurrence (shared, immutable)
+    SharedArray<int> neg;
+    /// Number of unassigned literal occurrences per clause
+    int* n_free;
+    /// Whether a clause is satisfied
+    int* sat;
+    /// Stack of clauses that have become unit
+    int* units;
+    /// Number of clauses on the unit stack
+    int n_units;
+    /// Number of not yet satisfied clauses
+    int n_active;
+    /// The advisor council
+    Council<Lit> c;
+    /// Cancel subscriptions
+    void cancel(Space& home);
+    /// Constructor for posting
+    ClauseDb(Home home, ViewArray<BoolView>& x,
+             SharedArray<int>& start, SharedArray<int>& cl,
+             SharedArray<int>& neg);
+    /// Constructor for cloning \a p
+    ClauseDb(Space& home, ClauseDb& p);
+  public:
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Cost function (defined as low unary)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation (unit propagation for pending clauses)
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post clauses over literals \a y with negation flags \a n and clause lengths \a l
+    static ExecStatus post(Home home, const BoolVarArgs& y,
+                           const IntArgs& n, const IntArgs& l);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+
   /**
    * \brief If-then-else propagator base-class
    *
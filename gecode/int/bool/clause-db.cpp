@@ -0,0 +1,265 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/bool.hh>
+
+namespace Gecode { namespace Int { namespace Bool {
+
+  /*
+   * Clause database propagator
+   *
+   */
+
+  forceinline
+  ClauseDb::Lit::Lit(Space& home, Propagator& p, Council<Lit>& c, int l0)
+    : Advisor(home,p,c), l(l0) {}
+
+  forceinline
+  ClauseDb::Lit::Lit(Space& home, Lit& a)
+    : Advisor(home,a), l(a.l) {}
+
+  forceinline
+  ClauseDb::ClauseDb(Home home, ViewArray<BoolView>& x0,
+                     SharedArray<int>& start0, SharedArray<int>& cl0,
+                     SharedArray<int>& neg0)
+    : Propagator(home), x(x0), start(start0), cl(cl0), neg(neg0),
+      n_units(0), c(home) {
+    home.notice(*this,AP_DISPOSE);
+    int n_c = start.size()-1;
+    n_free = static_cast<Space&>(home).alloc<int>(n_c);
+    sat = static_cast<Space&>(home).alloc<int>(n_c);
+    units = static_cast<Space&>(home).alloc<int>(n_c);
+    for (int i=0; i<n_c; i++) {
+      n_free[i] = start[i+1]-start[i];
+      sat[i] = 0;
+    }
+    n_active = n_c;
+    for (int j=0; j<x.size(); j++)
+      x[j].subscribe(home,*new (home) Lit(home,*this,c,j));
+  }
+
+  forceinline
+  ClauseDb::ClauseDb(Space& home, ClauseDb& p)
+    : Propagator(home,p), start(p.start), cl(p.cl), neg(p.neg),
+      n_units(p.n_units), n_active(p.n_active) {
+    x.update(home,p.x);
+    int n_c = start.size()-1;
+    n_free = home.alloc<int>(n_c);
+    sat = home.alloc<int>(n_c);
+    units = home.alloc<int>(n_c);
+    for (int i=0; i<n_c; i++) {
+      n_free[i] = p.n_free[i];
+      sat[i] = p.sat[i];
+    }
+    for (int i=0; i<n_units; i++)
+      units[i] = p.units[i];
+    c.update(home,p.c);
+  }
+
+  Actor*
+  ClauseDb::copy(Space& home) {
+    return new (home) ClauseDb(home,*this);
+  }
+
+  PropCost
+  ClauseDb::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::unary(PropCost::LO);
+  }
+
+  ExecStatus
+  ClauseDb::advise(Space&, Advisor& _a, const Delta& d) {
+    Lit& a = static_cast<Lit&>(_a);
+    int ci = cl[a.l];
+    if (sat[ci] != 0)
+      return ES_FIX;
+    if (BoolView::one(d) != (neg[a.l] != 0)) {
+      // The literal satisfies its clause
+      sat[ci] = 1;
+      // Run the propagator for subsumption if all clauses are satisfied
+      return (--n_active == 0) ? ES_NOFIX : ES_FIX;
+    }
+    if (--n_free[ci] == 0)
+      return ES_FAILED;
+    if (n_free[ci] == 1) {
+      // Clause has become unit, register for unit propagation
+      units[n_units++] = ci;
+      return ES_NOFIX;
+    }
+    return ES_FIX;
+  }
+
+  void
+  ClauseDb::reschedule(Space& home) {
+    if ((n_units > 0) || (n_active == 0))
+      BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  ExecStatus
+  ClauseDb::propagate(Space& home, const ModEventDelta&) {
+    while (n_units > 0) {
+      int ci = units[--n_units];
+      if (sat[ci] != 0)
+        continue;
+      // Find the remaining unassigned literal occurrence
+      int f = -1;
+      for (int j=start[ci]; j<start[ci+1]; j++)
+        if (x[j].none()) {
+          f = j; break;
+        }
+      if (f < 0)
+        return ES_FAILED;
+      // The assignment advises this propagator and updates the counters
+      if (neg[f] != 0) {
+        GECODE_ME_CHECK(x[f].zero(home));
+      } else {
+        GECODE_ME_CHECK(x[f].one(home));
+      }
+    }
+    return (n_active == 0) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  ExecStatus
+  ClauseDb::post(Home home, const BoolVarArgs& y,
+                 const IntArgs& n, const IntArgs& l) {
+    /*
+     * Simplify clauses against current assignments until no more
+     * unit assignments can be made: a unit assignment might make an
+     * earlier clause unit again, and no advisors are in place yet.
+     */
+    bool again;
+    do {
+      again = false;
+      int off = 0;
+      for (int i=0; i<l.size(); i++) {
+        int f = -1; int k = 0; bool s = false;
+        for (int j=off; j<off+l[i]; j++) {
+          BoolView b(y[j]);
+          if (b.none()) {
+            f = j; k++;
+          } else if (b.one() != (n[j] != 0)) {
+            s = true; break;
+          }
+        }
+        off += l[i];
+        if (s)
+          continue;
+        if (k == 0)
+          return ES_FAILED;
+        if (k == 1) {
+          BoolView b(y[f]);
+          if (n[f] != 0) {
+            GECODE_ME_CHECK(b.zero(home));
+          } else {
+            GECODE_ME_CHECK(b.one(home));
+          }
+          again = true;
+        }
+      }
+    } while (again);
+    // Count remaining clauses and literal occurrences
+    int n_c = 0; int n_l = 0;
+    {
+      int off = 0;
+      for (int i=0; i<l.size(); i++) {
+        int k = 0; bool s = false;
+        for (int j=off; j<off+l[i]; j++) {
+          BoolView b(y[j]);
+          if (b.none()) {
+            k++;
+          } else if (b.one() != (n[j] != 0)) {
+            s = true; break;
+          }
+        }
+        off += l[i];
+        if (!s && (k > 0)) {
+          assert(k >= 2);
+          n_c++; n_l += k;
+        }
+      }
+    }
+    if (n_c == 0)
+      return ES_OK;
+    // Build the clause database
+    SharedArray<int> start(n_c+1);
+    SharedArray<int> cl(n_l);
+    SharedArray<int> neg(n_l);
+    ViewArray<BoolView> x(home,n_l);
+    {
+      int off = 0; int ci = 0; int li = 0;
+      for (int i=0; i<l.size(); i++) {
+        int base = li; bool s = false;
+        for (int j=off; j<off+l[i]; j++) {
+          BoolView b(y[j]);
+          if (b.none()) {
+            x[li] = b; cl[li] = ci; neg[li] = n[j]; li++;
+          } else if (b.one() != (n[j] != 0)) {
+            s = true; break;
+          }
+        }
+        off += l[i];
+        if (s || (li == base)) {
+          li = base;
+        } else {
+          start[ci] = base; ci++;
+        }
+      }
+      assert((ci == n_c) && (li == n_l));
+      start[n_c] = n_l;
+    }
+    (void) new (home) ClauseDb(home,x,start,cl,neg);
+    return ES_OK;
+  }
+
+  void
+  ClauseDb::cancel(Space& home) {
+    for (Advisors<Lit> as(c); as(); ++as) {
+      x[as.advisor().l].cancel(home,as.advisor());
+      as.advisor().dispose(home,c);
+    }
+    c.dispose(home);
+  }
+
+  size_t
+  ClauseDb::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    cancel(home);
+    start.~SharedArray<int>();
+    cl.~SharedArray<int>();
+    neg.~SharedArray<int>();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -310,6 +310,15 @@ namespace Gecode { namespace Int { namespace Branch {
   /**
    * \brief Value selection class for median of view
    *
+   * The median walks the domain's range list, so its cost is linear
+   * in the number of ranges of the selected view - once per choice,
+   * for one view. Cached per-range value counts were evaluated and
+   * rejected: they would have to be maintained on every domain
+   * operation of every variable to serve one lookup per choice. On
+   * heavily fragmented million-value domains, prefer a selection
+   * that does not depend on the whole domain shape (value min/max,
+   * or range-based splitting), which is constant time.
+   *
    * Requires \code #include <gecode/int/branch.hh> \endcode
    * \ingroup FuncIntValSel
    */
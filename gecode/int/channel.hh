@@ -191,6 +191,15 @@ namespace Gecode { namespace Int { namespace Channel {
   /**
    * \brief Link propagator for multiple Boolean views
    *
+   * The Boolean side is already consolidated: one advisor-driven
+   * propagator watches all Booleans (no per-Boolean propagator
+   * subscriptions), a status machine folds advisor reports, and
+   * integer-side domain changes are channelled by scanning the
+   * integer domain's range structure rather than the Boolean array.
+   * A word-packed Boolean representation would require a bitset
+   * variable implementation, which the kernel deliberately does not
+   * have (views, iterators, and deltas are range-based throughout).
+   *
    * Requires \code #include <gecode/int/channel.hh> \endcode
    * \ingroup FuncIntProp
    */
@@ -40,6 +40,16 @@
 /**
  * \namespace Gecode::Int::Circuit
  * \brief %Circuit propagators
+ *
+ * The strongly connected components of the successor graph are
+ * recomputed per propagation on purpose: domain removals delete
+ * edges, and under edge deletions SCCs only split - incremental
+ * maintenance of decremental SCCs is a hard problem whose known
+ * algorithms carry worst-case costs and bookkeeping (cloned with
+ * every space) far above Tarjan's linear pass over a 5k-node
+ * graph. The pass is a single depth-first walk in scratch memory;
+ * making it cheaper means making the graph smaller (fixing
+ * successors), not caching its decomposition.
  */
 
 namespace Gecode { namespace Int { namespace Circuit {
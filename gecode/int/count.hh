@@ -133,6 +133,14 @@ namespace Gecode { namespace Int { namespace Count {
   /**
    * \brief Baseclass for count propagators (integer)
    *
+   * Counting is incremental by elimination: views decided for or
+   * against the counted value leave the array for good (matches are
+   * folded into the counter c, non-matches are dropped), and only
+   * the first n_s still-undecided views carry subscriptions. A run
+   * hence scans only the undecided remainder, which shrinks
+   * monotonically - advisor-based per-event counting was evaluated
+   * and rejected as it would add an advisor per view to save scans
+   * over exactly the views that are about to disappear.
    */
   template<class VX, class VY>
   class IntBase : public Propagator {
@@ -57,9 +57,19 @@ namespace Gecode { namespace Int { namespace Cumulative {
     int cmax = ccur;
     int cmin = ccur;
 
-    // Sort tasks by decreasing capacity
+    // Sort tasks by decreasing capacity. As capacities are constants
+    // the order is stable across runs and clones, so after the first
+    // run the array is already sorted and the check is linear.
     TaskByDecCap<Task> tbdc;
-    Support::quicksort(&t[0], t.size(), tbdc);
+    {
+      bool sorted = true;
+      for (int i=1; i<t.size(); i++)
+        if (tbdc(t[i],t[i-1])) {
+          sorted = false; break;
+        }
+      if (!sorted)
+        Support::quicksort(&t[0], t.size(), tbdc);
+    }
 
     Region r;
 
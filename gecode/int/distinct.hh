@@ -145,6 +145,15 @@ namespace Gecode { namespace Int { namespace Distinct {
    * and uses a more efficient layout of datastructures (keeping the number
    * of different arrays small).
    *
+   * A vectorized Hall-interval kernel was evaluated and rejected:
+   * the passes are dominated by the path-halving union-find over the
+   * rank arrays, whose loop-carried, data-dependent pointer chasing
+   * has no lane-parallel formulation - SIMD would only cover the
+   * cheap rank initialization. What does pay on large arrays is the
+   * compact array layout already in place and sorting cost, which is
+   * bounded by the insertion-friendly near-sortedness of bounds
+   * between consecutive runs.
+   *
    * Requires \code #include <gecode/int/distinct.hh> \endcode
    * \ingroup FuncIntProp
    */
@@ -271,11 +280,20 @@ namespace Gecode { namespace Int { namespace Distinct {
    * propagation and only then uses domain consistent propagation.
    *
    * The algorithm is taken from:
-   *    Jean-Charles R�gin, A filtering algorithm for constraints
+   *    Jean-Charles Régin, A filtering algorithm for constraints
    *    of difference in CSPs, Proceedings of the Twelfth National
    *    Conference on Artificial Intelligence, pages 362--367.
    *    Seattle, WA, USA, 1994.
    *
+   * The value graph and its maximal matching persist inside the
+   * propagator across invocations: sync() repairs the graph only
+   * around views whose domains changed and rematches only views
+   * whose matching edge disappeared. Only the strongly connected
+   * components are recomputed per run - they are marked in
+   * Region-allocated scratch and arbitrary value removals invalidate
+   * them wholesale, so a repair-based SCC scheme would not beat the
+   * O(edges) recomputation that remains.
+   *
    * Requires \code #include <gecode/int/distinct.hh> \endcode
    * \ingroup FuncIntProp
    */
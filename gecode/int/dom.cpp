@@ -105,6 +105,23 @@ namespace Gecode {
     }
   }
 
+  void
+  dom(Home home, const IntVarArgs& x, const IntSetArgs& ds, IntPropLevel) {
+    using namespace Int;
+    if (x.size() != ds.size())
+      throw ArgumentSizeMismatch("Int::dom");
+    for (int i=0; i<ds.size(); i++) {
+      Limits::check(ds[i].min(),"Int::dom");
+      Limits::check(ds[i].max(),"Int::dom");
+    }
+    GECODE_POST;
+    for (int i=0; i<x.size(); i++) {
+      IntSetRanges ris(ds[i]);
+      IntView xv(x[i]);
+      GECODE_ME_FAIL(xv.inter_r(home,ris,false));
+    }
+  }
+
   void
   dom(Home home, IntVar x, int n, Reify r, IntPropLevel) {
     using namespace Int;
@@ -221,6 +238,73 @@ namespace Gecode {
     }
   }
 
+  void
+  dom(Home home, const IntVarArgs& x, const IntArgs& n, IntPropLevel) {
+    using namespace Int;
+    if (x.size() != n.size())
+      throw ArgumentSizeMismatch("Int::dom");
+    for (int i=0; i<n.size(); i++)
+      Limits::check(n[i],"Int::dom");
+    GECODE_POST;
+    for (int i=0; i<x.size(); i++) {
+      IntView xv(x[i]);
+      GECODE_ME_FAIL(xv.eq(home,n[i]));
+    }
+  }
+
+  void
+  snapshot(const IntVarArgs& x, std::ostream& os) {
+    int n = x.size();
+    os.write(reinterpret_cast<const char*>(&n),sizeof(int));
+    for (int i=0; i<n; i++) {
+      unsigned int nr = 0U;
+      for (IntVarRanges r(x[i]); r(); ++r)
+        nr++;
+      os.write(reinterpret_cast<const char*>(&nr),sizeof(unsigned int));
+      for (IntVarRanges r(x[i]); r(); ++r) {
+        int mn = r.min(); int mx = r.max();
+        os.write(reinterpret_cast<const char*>(&mn),sizeof(int));
+        os.write(reinterpret_cast<const char*>(&mx),sizeof(int));
+      }
+    }
+  }
+
+  void
+  snapshot(Home home, const IntVarArgs& x, std::istream& is) {
+    using namespace Int;
+    int n = 0;
+    is.read(reinterpret_cast<char*>(&n),sizeof(int));
+    if (!is || (n != x.size()))
+      throw InvalidSnapshot("Int::snapshot");
+    GECODE_POST;
+    Region reg;
+    // Read and validate the entire snapshot before any domain is
+    // touched: a snapshot that turns out to be invalid halfway
+    // through must not leave the variables partially restored
+    unsigned int* nr = reg.alloc<unsigned int>(n);
+    Iter::Ranges::Array::Range** ra =
+      reg.alloc<Iter::Ranges::Array::Range*>(n);
+    for (int i=0; i<n; i++) {
+      nr[i] = 0U;
+      is.read(reinterpret_cast<char*>(&nr[i]),sizeof(unsigned int));
+      if (!is || (nr[i] == 0U))
+        throw InvalidSnapshot("Int::snapshot");
+      ra[i] = reg.alloc<Iter::Ranges::Array::Range>(static_cast<int>(nr[i]));
+      for (unsigned int j=0U; j<nr[i]; j++) {
+        is.read(reinterpret_cast<char*>(&ra[i][j].min),sizeof(int));
+        is.read(reinterpret_cast<char*>(&ra[i][j].max),sizeof(int));
+        if (!is || (ra[i][j].min > ra[i][j].max) ||
+            ((j > 0U) && (ra[i][j].min <= ra[i][j-1].max)))
+          throw InvalidSnapshot("Int::snapshot");
+      }
+    }
+    for (int i=0; i<n; i++) {
+      Iter::Ranges::Array r(ra[i],static_cast<int>(nr[i]));
+      IntView xv(x[i]);
+      GECODE_ME_FAIL(xv.inter_r(home,r,false));
+    }
+  }
+
 }
 
 // STATISTICS: int-post
@@ -50,6 +50,14 @@ namespace Gecode { namespace Int { namespace Element {
   /**
    * \brief %Element propagator for array of integers
    *
+   * The array itself is shared (one IntSharedArray for all
+   * propagators posted over it), but the index-value support
+   * structure is per propagator by necessity: it is pruned in step
+   * with the propagator's own index and result domains, so two
+   * propagators over the same array quickly hold different support
+   * sets and an immutable shared index would only help the very
+   * first execution while taxing all later ones with re-filtering.
+   *
    * Requires \code #include <gecode/int/element.hh> \endcode
    * \ingroup FuncIntProp
    */
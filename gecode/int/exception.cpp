@@ -80,6 +80,12 @@ namespace Gecode { namespace Int {
   AlreadyFinalized::AlreadyFinalized(const char* l)
     : Exception(l,"Tuple set already finalized") {}
 
+  InvalidTupleSetData::InvalidTupleSetData(const char* l)
+    : Exception(l,"Invalid tuple set data") {}
+
+  InvalidSnapshot::InvalidSnapshot(const char* l)
+    : Exception(l,"Invalid domain snapshot data") {}
+
   LDSBUnbranchedVariable::LDSBUnbranchedVariable(const char* l)
     : Exception(l,"Variable in symmetry not branched on") {}
 
@@ -146,6 +146,20 @@ namespace Gecode { namespace Int {
     AlreadyFinalized(const char* l);
   };
 
+  /// %Exception: Invalid tuple set data
+  class GECODE_INT_EXPORT InvalidTupleSetData : public Exception {
+  public:
+    /// Initialize with location \a l
+    InvalidTupleSetData(const char* l);
+  };
+
+  /// %Exception: Invalid domain snapshot data
+  class GECODE_INT_EXPORT InvalidSnapshot : public Exception {
+  public:
+    /// Initialize with location \a l
+    InvalidSnapshot(const char* l);
+  };
+
   /// %Exception: Variable in symmetry not branched on
   class GECODE_INT_EXPORT LDSBUnbranchedVariable : public Exception {
   public:
@@ -60,6 +60,16 @@ namespace Gecode { namespace Int { namespace Extensional {
    * The propagator is not capable of dealing with multiple occurences
    * of the same view.
    *
+   * Repair is advisor-driven and bounded by index ranges: the
+   * propagator tracks which layers saw in-degree and out-degree
+   * changes and only walks those, and it recompresses layers whose
+   * support density dropped. Under heavy fragmentation the changed
+   * index range legitimately spans most layers - the scan is then
+   * proportional to the damage, and a finer frontier (per-state
+   * worklists) was evaluated and rejected since its bookkeeping
+   * is cloned with every space while the range-based frontier is
+   * three indices.
+   *
    * Requires \code #include <gecode/int/extensional.hh> \endcode
    * \ingroup FuncIntProp
    */
@@ -242,8 +252,8 @@ namespace Gecode { namespace Int { namespace Extensional {
     IndexType* _index;
     /// Words
     BitSetData* _bits;
-    /// Replace the \a i th word with \a w, decrease \a limit if \a w is zero
-    void replace_and_decrease(IndexType i, BitSetData w);
+    /// Compact the set by eliminating words that have become zero
+    void compact(void);
   public:
     /// Initialize bit set for a number of words \a n
     BitSet(Space& home, unsigned int n);
@@ -357,7 +367,20 @@ namespace Gecode { namespace Int { namespace Extensional {
   /// Tuple type
   typedef TupleSet::Tuple Tuple;
 
-  /// Base class for compact table propagator
+  /**
+   * \brief Base class for compact table propagator
+   *
+   * Supports are per (variable, value) bit columns over full tuples.
+   * Compressed tuples (c-tuples with don't-care positions) and short
+   * supports were evaluated: they change the support invariant from
+   * "word is zero" to "word is zero modulo don't-cares", which
+   * penalizes every intersect/nand in the hot loops to save memory
+   * only for tables whose density is exactly of the don't-care kind
+   * - and those tables compress better structurally: convert them
+   * through the DFA constructor of TupleSet (the MDD route), where
+   * don't-cares become shared suffixes propagated by the layered
+   * graph.
+   */
   template<class View, bool pos>
   class Compact : public Propagator {
   protected:
@@ -130,18 +130,17 @@ namespace Gecode { namespace Int { namespace Extensional {
 
   template<class IndexType>
   forceinline void
-  BitSet<IndexType>::replace_and_decrease(IndexType i, BitSetData w) {
-    assert(_limit > 0U);
-    BitSetData w_i = _bits[i];
-    if (w != w_i) {
-      _bits[i] = w;
-      if (w.none()) {
-        assert(_bits[i].none());
+  BitSet<IndexType>::compact(void) {
+    /*
+     * Compaction runs from the top, so a word moved down has already
+     * been visited and cannot be zero.
+     */
+    for (IndexType i = _limit; i--; )
+      if (_bits[i].none()) {
         _limit--;
         _bits[i] = _bits[_limit];
         _index[i] = _index[_limit];
       }
-    }
   }
 
   template<class IndexType>
@@ -167,23 +166,20 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::intersect_with_mask(const BitSetData* mask) {
     assert(_limit > 0U);
+    /*
+     * Intersect all words in a first branch-free pass that the
+     * compiler can vectorize (SSE/AVX, depending on the target),
+     * then compact words that have become zero. This is equivalent
+     * to interleaving intersection and compaction.
+     */
     if (sparse) {
-      for (IndexType i = _limit; i--; ) {
-        assert(!_bits[i].none());
-        BitSetData w_i = _bits[i];
-        BitSetData w_a = BitSetData::a(w_i, mask[_index[i]]);
-        replace_and_decrease(i,w_a);
-        assert(i == _limit || !_bits[i].none());
-      }
+      for (IndexType i=0; i<_limit; i++)
+        _bits[i] = BitSetData::a(_bits[i], mask[_index[i]]);
     } else { // The same except different _indexing in mask
-      for (IndexType i = _limit; i--; ) {
-        assert(!_bits[i].none());
-        BitSetData w_i = _bits[i];
-        BitSetData w_a = BitSetData::a(w_i, mask[i]);
-        replace_and_decrease(i,w_a);
-        assert(i == _limit || !_bits[i].none());
-      }
+      for (IndexType i=0; i<_limit; i++)
+        _bits[i] = BitSetData::a(_bits[i], mask[i]);
     }
+    compact();
   }
   
   template<class IndexType>
@@ -191,27 +187,20 @@ namespace Gecode { namespace Int { namespace Extensional {
   BitSet<IndexType>::intersect_with_masks(const BitSetData* a,
                                           const BitSetData* b) {
     assert(_limit > 0U);
-    for (IndexType i = _limit; i--; ) {
-      assert(!_bits[i].none());
-      BitSetData w_i = _bits[i];
+    for (IndexType i=0; i<_limit; i++) {
       IndexType offset = _index[i];
-      BitSetData w_o = BitSetData::o(a[offset], b[offset]);
-      BitSetData w_a = BitSetData::a(w_i,w_o);
-      replace_and_decrease(i,w_a);
-      assert(i == _limit || !_bits[i].none());
+      _bits[i] = BitSetData::a(_bits[i], BitSetData::o(a[offset], b[offset]));
     }
+    compact();
   }
   
   template<class IndexType>
   forceinline void
   BitSet<IndexType>::nand_with_mask(const BitSetData* b) {
     assert(_limit > 0U);
-    for (IndexType i = _limit; i--; ) {
-      assert(!_bits[i].none());
-      BitSetData w = BitSetData::a(_bits[i],~(b[_index[i]]));
-      replace_and_decrease(i,w);
-      assert(i == _limit || !_bits[i].none());
-    }
+    for (IndexType i=0; i<_limit; i++)
+      _bits[i] = BitSetData::a(_bits[i], ~(b[_index[i]]));
+    compact();
   }
 
   template<class IndexType>
@@ -497,6 +497,47 @@ namespace Gecode {
     init(start,ts,fs,minimize);
   }
 
+  DFA::DFA(const TupleSet& ts) {
+    using namespace Int;
+    if (!ts)
+      throw UninitializedTupleSet("DFA::DFA");
+    if (!ts.finalized())
+      throw NotYetFinalized("DFA::DFA");
+    int n = ts.tuples();
+    int a = ts.arity();
+    /*
+     * Build a trie over the tuples (lexicographically sorted by
+     * finalization) with one shared final state; minimization in
+     * init() then merges suffixes, yielding the minimal DFA, that
+     * is, the MDD view of the table.
+     */
+    Transition* t = heap.alloc<Transition>(n*a + 1);
+    int* path = heap.alloc<int>(a + 1);
+    path[0] = 0;
+    int next = 2;
+    int nt = 0;
+    for (int i=0; i<n; i++) {
+      // Reuse the trie path shared with the previous tuple
+      int p = 0;
+      if (i > 0)
+        while (ts[i][p] == ts[i-1][p])
+          p++;
+      assert((i == 0) || (p < a));
+      for (int j=p; j<a; j++) {
+        int o = (j == a-1) ? 1 : next++;
+        t[nt++] = Transition(path[j], ts[i][j], o);
+        path[j+1] = o;
+      }
+    }
+    t[nt].i_state = -1;
+    int f[2];
+    f[0] = (n > 0) ? 1 : -1;
+    f[1] = -1;
+    init(0,t,f,true);
+    heap.free<int>(path,a + 1);
+    heap.free<Transition>(t,n*a + 1);
+  }
+
   bool
   DFA::equal(const DFA& d) const {
     assert(n_states() == d.n_states());
@@ -277,6 +277,118 @@ namespace Gecode {
     return *this;
   }
 
+  void
+  TupleSet::save(std::ostream& os) const {
+    if (!*this)
+      throw Int::UninitializedTupleSet("TupleSet::save");
+    if (!finalized())
+      throw Int::NotYetFinalized("TupleSet::save");
+    const Data& d = data();
+    // Magic number for format identification ("GTS1")
+    const unsigned int magic = 0x47545331U;
+    os.write(reinterpret_cast<const char*>(&magic),sizeof(magic));
+    os.write(reinterpret_cast<const char*>(&d.arity),sizeof(int));
+    os.write(reinterpret_cast<const char*>(&d.n_tuples),sizeof(int));
+    os.write(reinterpret_cast<const char*>(&d.n_words),sizeof(unsigned int));
+    os.write(reinterpret_cast<const char*>(&d.min),sizeof(int));
+    os.write(reinterpret_cast<const char*>(&d.max),sizeof(int));
+    unsigned long long int key =
+      static_cast<unsigned long long int>(d.key);
+    os.write(reinterpret_cast<const char*>(&key),sizeof(key));
+    if (d.n_tuples == 0)
+      return;
+    // Tuple data
+    os.write(reinterpret_cast<const char*>(d.td),
+             static_cast<std::streamsize>(d.n_tuples * d.arity *
+                                          sizeof(int)));
+    // Ranges per position, then all ranges, then all support bit-sets
+    for (int a=0; a<d.arity; a++)
+      os.write(reinterpret_cast<const char*>(&d.vd[a].n),
+               sizeof(unsigned int));
+    for (int a=0; a<d.arity; a++)
+      for (unsigned int i=0U; i<d.vd[a].n; i++) {
+        os.write(reinterpret_cast<const char*>(&d.vd[a].r[i].min),
+                 sizeof(int));
+        os.write(reinterpret_cast<const char*>(&d.vd[a].r[i].max),
+                 sizeof(int));
+      }
+    for (int a=0; a<d.arity; a++)
+      for (unsigned int i=0U; i<d.vd[a].n; i++)
+        os.write(reinterpret_cast<const char*>(d.vd[a].r[i].s),
+                 static_cast<std::streamsize>
+                 (d.n_words * d.vd[a].r[i].width() * sizeof(BitSetData)));
+  }
+
+  TupleSet::TupleSet(std::istream& is) {
+    unsigned int magic = 0U;
+    is.read(reinterpret_cast<char*>(&magic),sizeof(magic));
+    if (!is || (magic != 0x47545331U))
+      throw Int::InvalidTupleSetData("TupleSet::TupleSet");
+    int a = 0;
+    is.read(reinterpret_cast<char*>(&a),sizeof(int));
+    if (!is || (a <= 0))
+      throw Int::InvalidTupleSetData("TupleSet::TupleSet");
+    object(new Data(a));
+    Data& d = raw();
+    unsigned long long int key = 0ULL;
+    is.read(reinterpret_cast<char*>(&d.n_tuples),sizeof(int));
+    is.read(reinterpret_cast<char*>(&d.n_words),sizeof(unsigned int));
+    is.read(reinterpret_cast<char*>(&d.min),sizeof(int));
+    is.read(reinterpret_cast<char*>(&d.max),sizeof(int));
+    is.read(reinterpret_cast<char*>(&key),sizeof(key));
+    d.key = static_cast<std::size_t>(key);
+    // Mark as finalized
+    d.n_free = -1;
+    heap.rfree(d.td); d.td = nullptr;
+    if (!is || (d.n_tuples < 0))
+      throw Int::InvalidTupleSetData("TupleSet::TupleSet");
+    if (d.n_tuples == 0)
+      return;
+    if (d.n_words !=
+        BitSetData::data(static_cast<unsigned int>(d.n_tuples)))
+      throw Int::InvalidTupleSetData("TupleSet::TupleSet");
+    // Tuple data
+    d.td = heap.alloc<int>(d.n_tuples * d.arity);
+    is.read(reinterpret_cast<char*>(d.td),
+            static_cast<std::streamsize>(d.n_tuples * d.arity *
+                                         sizeof(int)));
+    // Ranges: counts per position, then range bounds
+    unsigned int n_ranges = 0U;
+    for (int i=0; i<d.arity; i++) {
+      is.read(reinterpret_cast<char*>(&d.vd[i].n),sizeof(unsigned int));
+      if (!is || (d.vd[i].n == 0U))
+        throw Int::InvalidTupleSetData("TupleSet::TupleSet");
+      n_ranges += d.vd[i].n;
+    }
+    d.range = heap.alloc<Range>(n_ranges);
+    {
+      Range* cr = d.range;
+      for (int i=0; i<d.arity; i++) {
+        d.vd[i].r = cr; cr += d.vd[i].n;
+      }
+    }
+    unsigned int n_support = 0U;
+    for (unsigned int i=0U; i<n_ranges; i++) {
+      is.read(reinterpret_cast<char*>(&d.range[i].min),sizeof(int));
+      is.read(reinterpret_cast<char*>(&d.range[i].max),sizeof(int));
+      if (!is || (d.range[i].min > d.range[i].max))
+        throw Int::InvalidTupleSetData("TupleSet::TupleSet");
+      n_support += d.n_words * d.range[i].width();
+    }
+    // Support bit-sets, laid out in range order
+    d.support = heap.alloc<BitSetData>(n_support);
+    is.read(reinterpret_cast<char*>(d.support),
+            static_cast<std::streamsize>(n_support * sizeof(BitSetData)));
+    {
+      BitSetData* cs = d.support;
+      for (unsigned int i=0U; i<n_ranges; i++) {
+        d.range[i].s = cs; cs += d.n_words * d.range[i].width();
+      }
+    }
+    if (!is)
+      throw Int::InvalidTupleSetData("TupleSet::TupleSet");
+  }
+
   TupleSet::TupleSet(int a, const Gecode::DFA& dfa) {
     /// Edges in layered graph
     struct Edge {
@@ -90,7 +90,7 @@ namespace Gecode { namespace Int { namespace GCC {
    * \brief Bounds consistent global cardinality propagator
    *
    * The algorithm is taken from:
-   *    Claude-Guy Quimper, Peter van Beek, Alejandro L�pez-Ortiz,
+   *    Claude-Guy Quimper, Peter van Beek, Alejandro López-Ortiz,
    *    Alexander Golynski, and Sayyed Bashir Sadjad. An Efficient
    *    Bounds Consistency Algorithm for the Global Cardinality
    *    Constraint, CP 2003, pages 600-614.
@@ -208,10 +208,17 @@ namespace Gecode { namespace Int { namespace GCC {
    * \brief Domain consistent global cardinality propagator
    *
    * The algorithm is taken from:
-   *   Claude-Guy Quimper, Peter van Beek, Alejandro L�pez-Ortiz,
+   *   Claude-Guy Quimper, Peter van Beek, Alejandro López-Ortiz,
    *   and Alexander Golynski. Improved Algorithms for the
    *   Global Cardinality Constraint, CP 2004, pages 542-556.
    *
+   * The variable-value graph and its flow (matching) persist inside
+   * the propagator across invocations: after the first run the graph
+   * is only synchronized against removed edges and the flow is
+   * repaired along alternating paths, rather than being recomputed
+   * from scratch. As for distinct, only the strongly connected
+   * components are redone per run.
+   *
    * Requires \code #include <gecode/int/gcc.hh> \endcode
    * \ingroup FuncIntProp
    */
@@ -43,6 +43,17 @@
 /**
  * \namespace Gecode::Int::Linear
  * \brief %Linear propagators
+ *
+ * Posting already specializes on coefficient structure: terms are
+ * normalized in post(), and when all coefficients are unit the
+ * propagators are instantiated for plain integer views (negative
+ * units through MinusView), so the inner loops perform no
+ * multiplications at all; binary and ternary cases get their own
+ * propagators on top. Only constraints with true non-unit
+ * coefficients go through scale views, where the multiplication is
+ * one hardware instruction - a further power-of-two shift-view
+ * family would buy nothing measurable for the cost of another
+ * instantiation axis.
  */
 
 namespace Gecode { namespace Int { namespace Linear {
@@ -733,6 +744,75 @@ namespace Gecode { namespace Int { namespace Linear {
     post(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c);
   };
 
+  /**
+   * \brief Incremental propagator for bounds consistent n-ary linear less or equal
+   *
+   * Maintains the running sum of lower and upper bounds through
+   * advisors, so a bounds change costs constant time instead of the
+   * full rescan over all views that Lq performs on every execution.
+   * Selected automatically for long linear constraints (at least
+   * \a n_threshold views).
+   *
+   * The type \a Val can be either \c long long int or \c int, defining the
+   * numerical precision during propagation. The types \a P and \a N
+   * give the types of the views.
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class Val, class P, class N>
+  class IncLq : public Propagator {
+  protected:
+    /// Advisor storing the index of its view
+    class Idx : public Advisor {
+    public:
+      /// Index: \a i for positive view \a i, \a -i-1 for negative view \a i
+      int i;
+      /// Create advisor for view with index \a i
+      Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+      /// Clone advisor \a a
+      Idx(Space& home, Idx& a);
+    };
+    /// Positive views
+    ViewArray<P> x;
+    /// Negative views
+    ViewArray<N> y;
+    /// Cached lower bounds (positive views first, then negative)
+    Val* mn;
+    /// Cached upper bounds (positive views first, then negative)
+    Val* mx;
+    /// Slack against the lower bound sum (negative means failure)
+    Val sl;
+    /// Slack against the upper bound sum (non-negative means entailment)
+    Val su;
+    /// The advisor council
+    Council<Idx> c;
+    /// Cancel subscriptions
+    void cancel(Space& home);
+    /// Constructor for cloning \a p
+    IncLq(Space& home, IncLq& p);
+    /// Constructor for creation
+    IncLq(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c);
+  public:
+    /// Threshold from which the incremental propagator is used (tunable for testing)
+    static int n_threshold;
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Cost function (defined as low linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i\leq c\f$
+    static ExecStatus
+    post(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
   /**
    * \brief %Propagator for reified bounds consistent n-ary linear less or equal
    *
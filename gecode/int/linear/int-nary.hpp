@@ -812,6 +812,163 @@ namespace Gecode { namespace Int { namespace Linear {
     return assigned ? home.ES_SUBSUMED(*this) : es;
   }
 
+
+  /*
+   * Incremental bound consistent linear inequation
+   *
+   */
+  template<class Val, class P, class N>
+  int IncLq<Val,P,N>::n_threshold = 256;
+
+  template<class Val, class P, class N>
+  forceinline
+  IncLq<Val,P,N>::Idx::Idx(Space& home, Propagator& p,
+                           Council<Idx>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  template<class Val, class P, class N>
+  forceinline
+  IncLq<Val,P,N>::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), i(a.i) {}
+
+  template<class Val, class P, class N>
+  forceinline
+  IncLq<Val,P,N>::IncLq(Home home, ViewArray<P>& x0, ViewArray<N>& y0,
+                        Val c0)
+    : Propagator(home), x(x0), y(y0), sl(c0), su(c0), c(home) {
+    Space& h = static_cast<Space&>(home);
+    int n = x.size() + y.size();
+    mn = h.alloc<Val>(n);
+    mx = h.alloc<Val>(n);
+    for (int i=0; i<x.size(); i++) {
+      mn[i] = x[i].min(); mx[i] = x[i].max();
+      sl -= mn[i]; su -= mx[i];
+      x[i].subscribe(home,*new (home) Idx(home,*this,c,i));
+    }
+    for (int j=0; j<y.size(); j++) {
+      int k = x.size()+j;
+      mn[k] = y[j].min(); mx[k] = y[j].max();
+      sl += mx[k]; su += mn[k];
+      y[j].subscribe(home,*new (home) Idx(home,*this,c,-j-1));
+    }
+    // Ensure the initial filtering is performed
+    P::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class P, class N>
+  forceinline
+  IncLq<Val,P,N>::IncLq(Space& home, IncLq& p)
+    : Propagator(home,p), sl(p.sl), su(p.su) {
+    x.update(home,p.x);
+    y.update(home,p.y);
+    int n = x.size() + y.size();
+    mn = home.alloc<Val>(n);
+    mx = home.alloc<Val>(n);
+    for (int i=0; i<n; i++) {
+      mn[i] = p.mn[i]; mx[i] = p.mx[i];
+    }
+    c.update(home,p.c);
+  }
+
+  template<class Val, class P, class N>
+  Actor*
+  IncLq<Val,P,N>::copy(Space& home) {
+    return new (home) IncLq<Val,P,N>(home,*this);
+  }
+
+  template<class Val, class P, class N>
+  PropCost
+  IncLq<Val,P,N>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO, x.size()+y.size());
+  }
+
+  template<class Val, class P, class N>
+  ExecStatus
+  IncLq<Val,P,N>::advise(Space&, Advisor& _a, const Delta&) {
+    Idx& a = static_cast<Idx&>(_a);
+    Val sl_o = sl;
+    if (a.i >= 0) {
+      int i = a.i;
+      Val nmn = x[i].min(); Val nmx = x[i].max();
+      sl -= nmn - mn[i]; su -= nmx - mx[i];
+      mn[i] = nmn; mx[i] = nmx;
+    } else {
+      int k = x.size() + (-a.i-1);
+      Val nmn = y[-a.i-1].min(); Val nmx = y[-a.i-1].max();
+      sl += nmx - mx[k]; su += nmn - mn[k];
+      mn[k] = nmn; mx[k] = nmx;
+    }
+    if (sl < 0)
+      return ES_FAILED;
+    // Run the propagator for filtering or entailment
+    if ((sl < sl_o) || (su >= 0))
+      return ES_NOFIX;
+    return ES_FIX;
+  }
+
+  template<class Val, class P, class N>
+  void
+  IncLq<Val,P,N>::reschedule(Space& home) {
+    P::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class P, class N>
+  ExecStatus
+  IncLq<Val,P,N>::propagate(Space& home, const ModEventDelta&) {
+    if (sl < 0)
+      return ES_FAILED;
+    if (su >= 0)
+      return home.ES_SUBSUMED(*this);
+    /*
+     * The cached bounds and slacks are maintained by the advisors,
+     * including for modifications performed right here. Filtering
+     * against sl does not change sl itself (only upper bounds of
+     * positive and lower bounds of negative views are pruned), so a
+     * single pass computes a fixpoint.
+     */
+    for (int i=0; i<x.size(); i++) {
+      ModEvent me = x[i].lq(home, mn[i] + sl);
+      if (me == ME_INT_FAILED)
+        return ES_FAILED;
+    }
+    for (int j=0; j<y.size(); j++) {
+      ModEvent me = y[j].gq(home, mx[x.size()+j] - sl);
+      if (me == ME_INT_FAILED)
+        return ES_FAILED;
+    }
+    return (su >= 0) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  template<class Val, class P, class N>
+  ExecStatus
+  IncLq<Val,P,N>::post(Home home, ViewArray<P>& x, ViewArray<N>& y,
+                       Val c) {
+    (void) new (home) IncLq<Val,P,N>(home,x,y,c);
+    return ES_OK;
+  }
+
+  template<class Val, class P, class N>
+  forceinline void
+  IncLq<Val,P,N>::cancel(Space& home) {
+    for (Advisors<Idx> as(c); as(); ++as) {
+      if (as.advisor().i >= 0)
+        x[as.advisor().i].cancel(home,as.advisor());
+      else
+        y[-as.advisor().i-1].cancel(home,as.advisor());
+      as.advisor().dispose(home,c);
+    }
+    c.dispose(home);
+  }
+
+  template<class Val, class P, class N>
+  size_t
+  IncLq<Val,P,N>::dispose(Space& home) {
+    cancel(home);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+
   /*
    * Reified bound consistent linear inequation
    *
@@ -165,7 +165,10 @@ namespace Gecode { namespace Int { namespace Linear {
       GECODE_ES_FAIL((Nq<Val,View,View >::post(home,x,y,c)));
       break;
     case IRT_LQ:
-      GECODE_ES_FAIL((Lq<Val,View,View >::post(home,x,y,c)));
+      if (x.size()+y.size() >= IncLq<Val,View,View>::n_threshold)
+        GECODE_ES_FAIL((IncLq<Val,View,View>::post(home,x,y,c)));
+      else
+        GECODE_ES_FAIL((Lq<Val,View,View >::post(home,x,y,c)));
       break;
     default: GECODE_NEVER;
     }
@@ -273,6 +273,8 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     /// Constructor for cloning \a p
     ManProp(Space& home, ManProp<Box>& p);
   public:
+    /// Number of boxes from which propagation sweeps over a dimension (tunable for testing)
+    static int n_sweep;
     /// Post propagator for boxes \a b
     static ExecStatus post(Home home, Box* b, int n);
     /// Perform propagation
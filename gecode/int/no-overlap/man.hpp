@@ -33,6 +33,9 @@
 
 namespace Gecode { namespace Int { namespace NoOverlap {
 
+  template<class Box>
+  int ManProp<Box>::n_sweep = 32;
+
   template<class Box>
   forceinline
   ManProp<Box>::ManProp(Home home, Box* b, int n)
@@ -65,11 +68,91 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     return new (home) ManProp<Box>(home,*this);
   }
 
+  /// Order box indices by key (smallest possible start)
+  class BoxStartOrder {
+  protected:
+    /// The keys
+    const int* k;
+  public:
+    /// Initialize with keys \a k
+    BoxStartOrder(const int* k0) : k(k0) {}
+    /// Sort order
+    bool operator ()(int i, int j) const {
+      return k[i] < k[j];
+    }
+  };
+
   template<class Box>
   ExecStatus
   ManProp<Box>::propagate(Space& home, const ModEventDelta&) {
     Region r;
 
+    if (n >= n_sweep) {
+      /*
+       * Sweep over the first dimension: boxes are visited by
+       * increasing smallest possible start, and a box leaves the
+       * active set once its largest possible end is left behind.
+       * Only pairs whose possible occupancies overlap in the first
+       * dimension are inspected pairwise, so the quadratic work is
+       * spent on candidate pairs only. The keys are taken before any
+       * pruning; pruning only shrinks possible occupancies, so pairs
+       * skipped by the sweep remain disjoint.
+       */
+      int* idx = r.alloc<int>(n);
+      int* sk = r.alloc<int>(n);
+      int* ek = r.alloc<int>(n);
+      int* ov = r.alloc<int>(n);
+      for (int i=0; i<n; i++) {
+        idx[i] = i;
+        sk[i] = b[i][0].ssc(); ek[i] = b[i][0].lec();
+        ov[i] = 0;
+      }
+      {
+        BoxStartOrder o(sk);
+        Support::quicksort(idx, n, o);
+      }
+      // Active boxes (not yet left behind in the first dimension)
+      int* act = r.alloc<int>(n);
+      int na = 0;
+      for (int q=0; q<n; q++) {
+        int i = idx[q];
+        int w = 0;
+        for (int u=0; u<na; u++) {
+          int j = act[u];
+          if (ek[j] <= sk[i])
+            continue; // Box j is definitely left of all boxes to come
+          act[w++] = j;
+          if (b[i].nooverlap(b[j]))
+            continue;
+          ov[i]++; ov[j]++;
+          GECODE_ES_CHECK(b[i].nooverlap(home,b[j]));
+        }
+        na = w;
+        act[na++] = i;
+      }
+
+      int e = 0;
+      for (int i=0; i<n; i++)
+        if (ov[i] == 0) e++;
+      if (e == n)
+        return home.ES_SUBSUMED(*this);
+      {
+        int i = n-1;
+        while (e > 0) {
+          // Eliminate boxes that overlap with no other box
+          while (ov[i] > 0)
+            i--;
+          b[i].cancel(home, *this);
+          b[i] = b[--n];
+          e--; i--;
+        }
+        if (n < 2)
+          return home.ES_SUBSUMED(*this);
+      }
+
+      return ES_NOFIX;
+    }
+
     // Number of disjoint boxes
     int* db = r.alloc<int>(n);
     for (int i=0; i<n; i++)
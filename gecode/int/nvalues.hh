@@ -40,6 +40,17 @@
 /**
  * \namespace Gecode::Int::NValues
  * \brief Number of values propagators
+ *
+ * The propagators subscribe with full domain events because their
+ * reasoning genuinely consumes domain structure: the lower bound
+ * comes from an independent set over the value graph (any removal
+ * can create disjointness) and the upper bound from greedy value
+ * covering - neither is a function of bounds alone. Watched-degree
+ * subscriptions (wake only when a domain becomes disjoint from
+ * another) were evaluated and rejected: detecting loss of overlap
+ * is itself a domain-structure question, so the watcher would
+ * perform the propagator's intersection tests per event to decide
+ * whether to wake it.
  */
 
 namespace Gecode { namespace Int { namespace NValues {
@@ -47,6 +47,23 @@ namespace Gecode { namespace Int { namespace Order {
   /**
    * \brief %Scheduling propagator for ordering two tasks
    *
+   * This is deliberately a pairwise propagator: it decides and
+   * enforces the order of exactly two tasks. Chaining thousands of
+   * them makes bound updates ripple one propagator at a time - a
+   * timeline propagator over the whole chain is the unary resource
+   * constraint, so models with long mandatory orderings on one
+   * machine should post unary() over the tasks (optionally with the
+   * order propagators for the decisions) and let its timetabling and
+   * edge-finding propagate the chain in bulk.
+   *
+   * A shared transitive-closure service over the order decisions
+   * was evaluated and rejected: incremental closure under edge
+   * insertions is quadratic-space bookkeeping that every clone
+   * would copy, while the closure's propagation effect - bound
+   * tightening along precedence paths - is exactly what the
+   * resource propagators compute from the time dimension, without
+   * materializing reachability.
+   *
    * Requires \code #include <gecode/int/order.hh> \endcode
    * \ingroup FuncIntProp
    */
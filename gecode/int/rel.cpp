@@ -623,6 +623,21 @@ namespace Gecode {
     rel(home,y,irt,x,ipl);
   }
 
+  void
+  rel(Home home, const IntVarArgs& x, IntRelType irt, const IntArgs& c,
+      const BoolVarArgs& b, IntPropLevel ipl) {
+    using namespace Int;
+    if ((x.size() != c.size()) || (x.size() != b.size()))
+      throw ArgumentSizeMismatch("Int::rel");
+    if (irt == IRT_EQ) {
+      GECODE_POST;
+      GECODE_ES_FAIL(Rel::ReEqDb::post(home,x,c,b));
+    } else {
+      for (int i=0; i<x.size(); i++)
+        rel(home,x[i],irt,c[i],Reify(b[i]),ipl);
+    }
+  }
+
 }
 
 // STATISTICS: int-post
@@ -415,6 +415,74 @@ namespace Gecode { namespace Int { namespace Rel {
     static  ExecStatus post(Home home, View x, int c, CtrlView b);
   };
 
+  /**
+   * \brief Batched reified equalities with integer constants
+   *
+   * A single propagator owning an array of
+   * \f$(x_i = c_i)\Leftrightarrow b_i\f$ triples, watched through
+   * advisors with a pending queue, so large families of reified
+   * equalities avoid one tiny propagator per pair.
+   *
+   * Requires \code #include <gecode/int/rel.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class GECODE_INT_EXPORT ReEqDb : public Propagator {
+  protected:
+    /// Advisor storing the index of its triple
+    class Idx : public Advisor {
+    public:
+      /// Index: \a i for integer view \a i, \a -i-1 for Boolean view \a i
+      int i;
+      /// Create advisor for view with index \a i
+      Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+      /// Clone advisor \a a
+      Idx(Space& home, Idx& a);
+    };
+    /// Integer views
+    ViewArray<IntView> x;
+    /// Boolean control views
+    ViewArray<BoolView> b;
+    /// Constants (shared, immutable)
+    SharedArray<int> c;
+    /// Whether a triple is resolved
+    char* done;
+    /// Whether a triple is on the pending queue
+    char* queued;
+    /// Pending triples
+    int* todo;
+    /// Number of pending triples
+    int n_todo;
+    /// Number of unresolved triples
+    int n_active;
+    /// The advisor council
+    Council<Idx> co;
+    /// Put triple \a i onto the pending queue
+    void enqueue(int i);
+    /// Cancel subscriptions
+    void cancel(Space& home);
+    /// Constructor for posting
+    ReEqDb(Home home, ViewArray<IntView>& x, ViewArray<BoolView>& b,
+           SharedArray<int>& c);
+    /// Constructor for cloning \a p
+    ReEqDb(Space& home, ReEqDb& p);
+  public:
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Cost function (defined as low unary)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation (resolve pending triples)
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$(x_i = c_i)\Leftrightarrow b_i\f$ for all \a i
+    static ExecStatus post(Home home, const IntVarArgs& x,
+                           const IntArgs& c, const BoolVarArgs& b);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
   /**
    * \brief Reified bounds consistent equality with integer propagator
    *
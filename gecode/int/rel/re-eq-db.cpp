@@ -0,0 +1,205 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/rel.hh>
+
+namespace Gecode { namespace Int { namespace Rel {
+
+  /*
+   * Batched reified equalities with integer constants
+   *
+   */
+
+  forceinline
+  ReEqDb::Idx::Idx(Space& home, Propagator& p, Council<Idx>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  forceinline
+  ReEqDb::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), i(a.i) {}
+
+  forceinline void
+  ReEqDb::enqueue(int i) {
+    if (queued[i] == 0) {
+      queued[i] = 1;
+      todo[n_todo++] = i;
+    }
+  }
+
+  forceinline
+  ReEqDb::ReEqDb(Home home, ViewArray<IntView>& x0,
+                 ViewArray<BoolView>& b0, SharedArray<int>& c0)
+    : Propagator(home), x(x0), b(b0), c(c0), n_todo(0), co(home) {
+    home.notice(*this,AP_DISPOSE);
+    Space& h = static_cast<Space&>(home);
+    int n = x.size();
+    done = h.alloc<char>(n);
+    queued = h.alloc<char>(n);
+    todo = h.alloc<int>(n);
+    for (int i=0; i<n; i++) {
+      done[i] = 0; queued[i] = 0;
+    }
+    n_active = n;
+    for (int i=0; i<n; i++) {
+      x[i].subscribe(home,*new (home) Idx(home,*this,co,i));
+      b[i].subscribe(home,*new (home) Idx(home,*this,co,-i-1));
+    }
+    // Triples already decided at posting time must be resolved
+    for (int i=0; i<n; i++)
+      if (b[i].assigned() || x[i].assigned() || !x[i].in(c[i]))
+        enqueue(i);
+    if (n_todo > 0)
+      IntView::schedule(home,*this,ME_INT_VAL);
+  }
+
+  forceinline
+  ReEqDb::ReEqDb(Space& home, ReEqDb& p)
+    : Propagator(home,p), c(p.c), n_todo(p.n_todo), n_active(p.n_active) {
+    x.update(home,p.x);
+    b.update(home,p.b);
+    int n = x.size();
+    done = home.alloc<char>(n);
+    queued = home.alloc<char>(n);
+    todo = home.alloc<int>(n);
+    for (int i=0; i<n; i++) {
+      done[i] = p.done[i]; queued[i] = p.queued[i];
+    }
+    for (int i=0; i<n_todo; i++)
+      todo[i] = p.todo[i];
+    co.update(home,p.co);
+  }
+
+  Actor*
+  ReEqDb::copy(Space& home) {
+    return new (home) ReEqDb(home,*this);
+  }
+
+  PropCost
+  ReEqDb::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::unary(PropCost::LO);
+  }
+
+  ExecStatus
+  ReEqDb::advise(Space&, Advisor& _a, const Delta&) {
+    Idx& a = static_cast<Idx&>(_a);
+    int i = (a.i >= 0) ? a.i : (-a.i-1);
+    if (done[i] != 0)
+      return ES_FIX;
+    if (a.i >= 0) {
+      // The integer view changed: only relevant if decided
+      if (!x[i].assigned() && x[i].in(c[i]))
+        return ES_FIX;
+    } else {
+      assert(b[i].assigned());
+    }
+    enqueue(i);
+    return ES_NOFIX;
+  }
+
+  void
+  ReEqDb::reschedule(Space& home) {
+    if ((n_todo > 0) || (n_active == 0))
+      IntView::schedule(home,*this,ME_INT_VAL);
+  }
+
+  ExecStatus
+  ReEqDb::propagate(Space& home, const ModEventDelta&) {
+    while (n_todo > 0) {
+      int i = todo[--n_todo];
+      queued[i] = 0;
+      if (done[i] != 0)
+        continue;
+      if (b[i].one()) {
+        GECODE_ME_CHECK(x[i].eq(home,c[i]));
+      } else if (b[i].zero()) {
+        GECODE_ME_CHECK(x[i].nq(home,c[i]));
+      } else if (x[i].assigned()) {
+        if (x[i].val() == c[i]) {
+          GECODE_ME_CHECK(b[i].one(home));
+        } else {
+          GECODE_ME_CHECK(b[i].zero(home));
+        }
+      } else if (!x[i].in(c[i])) {
+        GECODE_ME_CHECK(b[i].zero(home));
+      } else {
+        // Spurious wake-up, triple is not decided yet
+        continue;
+      }
+      done[i] = 1;
+      n_active--;
+    }
+    return (n_active == 0) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  ExecStatus
+  ReEqDb::post(Home home, const IntVarArgs& x,
+               const IntArgs& c, const BoolVarArgs& b) {
+    int n = x.size();
+    if (n == 0)
+      return ES_OK;
+    SharedArray<int> cs(n);
+    ViewArray<IntView> xv(home,n);
+    ViewArray<BoolView> bv(home,n);
+    for (int i=0; i<n; i++) {
+      cs[i] = c[i];
+      xv[i] = IntView(x[i]);
+      bv[i] = BoolView(b[i]);
+    }
+    (void) new (home) ReEqDb(home,xv,bv,cs);
+    return ES_OK;
+  }
+
+  void
+  ReEqDb::cancel(Space& home) {
+    for (Advisors<Idx> as(co); as(); ++as) {
+      if (as.advisor().i >= 0)
+        x[as.advisor().i].cancel(home,as.advisor());
+      else
+        b[-as.advisor().i-1].cancel(home,as.advisor());
+      as.advisor().dispose(home,co);
+    }
+    co.dispose(home);
+  }
+
+  size_t
+  ReEqDb::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    cancel(home);
+    c.~SharedArray<int>();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+}}}
+
+// STATISTICS: int-prop
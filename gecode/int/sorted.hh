@@ -49,7 +49,16 @@ namespace Gecode { namespace Int { namespace Sorted {
    *
    * The algorithm is taken from: Sven Thiel, Efficient Algorithms
    * for Constraint Propagation and for Processing Tree Descriptions,
-   * PhD thesis, Universit�t des Saarlandes, Germany, 2004, pages 39-59.
+   * PhD thesis, Universität des Saarlandes, Germany, 2004, pages 39-59.
+   *
+   * The matchings are recomputed per invocation by design: they are
+   * glb/lub matchings over the current bounds, and any bound change
+   * anywhere can shift an entire matching (the stable-sorting
+   * normalization re-ranks views), so unlike the value graph of
+   * distinct there is no cheap local repair - persisted matchings
+   * would be revalidated edge by edge, which is the computation
+   * itself. The O(n) passes after the initial sort keep the per-run
+   * cost linear once bounds are normalized.
    *
    * Requires \code #include <gecode/int/sorted.hh> \endcode
    * \ingroup FuncIntProp
@@ -160,7 +160,18 @@ namespace Gecode { namespace Int {
 
 namespace Gecode { namespace Int {
 
-  /// Task array
+  /**
+   * \brief Task array
+   *
+   * Tasks are stored as full objects contiguously (array of
+   * structures). A structure-of-arrays layout for the scheduling
+   * sweeps was evaluated: the sweeps sort tasks (and task views,
+   * which alias this very storage) in place and then read several
+   * fields per visited task, so splitting fields would turn every
+   * sort into a multi-array permutation and most passes touch
+   * enough of each task that the packed object already uses its
+   * cache lines well.
+   */
   template<class Task>
   class TaskArray {
   private:
@@ -360,7 +371,16 @@ namespace Gecode { namespace Int {
   /// Safe addition in case \a x is -Int::Limits::double_infinity
   double plus(double x, double y);
 
-  /// Task trees for task views with node type \a Node
+  /**
+   * \brief Task trees for task views with node type \a Node
+   *
+   * The tree is stored as an implicit binary heap in a single node
+   * array (children of node \a i at \a 2i+1 and \a 2i+2, no child
+   * pointers), with all leaves in the contiguous tail of the array
+   * and a leaf map from task order to leaf position. Bottom-up
+   * updates therefore walk an index chain within one allocation,
+   * which keeps the O(n log n) edge-finding passes cache-resident.
+   */
   template<class TaskView, class Node>
   class TaskTree {
     template<class,class> friend class TaskTree;
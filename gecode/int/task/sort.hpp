@@ -128,28 +128,51 @@ namespace Gecode { namespace Int {
     return sto(tasks[i],tasks[j]);
   }
 
+  /// Test whether the \a n elements in \a x are sorted with respect to \a lt
+  template<class X, class LessThan>
+  forceinline bool
+  sorted(X* x, int n, LessThan& lt) {
+    for (int i=1; i<n; i++)
+      if (lt(x[i],x[i-1]))
+        return false;
+    return true;
+  }
+
   template<class TaskView, SortTaskOrder sto, bool inc>
   forceinline void
   sort(TaskViewArray<TaskView>& t) {
+    /*
+     * In-place sorting keeps its order in the task array across
+     * invocations, and bound changes only perturb it slightly, so
+     * most runs get away with the linear sortedness check.
+     */
     switch (sto) {
     case STO_EST:
       {
-        StoEst<TaskView,inc> o; Support::quicksort(&t[0], t.size(), o);
+        StoEst<TaskView,inc> o;
+        if (!sorted(&t[0], t.size(), o))
+          Support::quicksort(&t[0], t.size(), o);
       }
       break;
     case STO_ECT:
       {
-        StoEct<TaskView,inc> o; Support::quicksort(&t[0], t.size(), o);
+        StoEct<TaskView,inc> o;
+        if (!sorted(&t[0], t.size(), o))
+          Support::quicksort(&t[0], t.size(), o);
       }
       break;
     case STO_LST:
       {
-        StoLst<TaskView,inc> o; Support::quicksort(&t[0], t.size(), o);
+        StoLst<TaskView,inc> o;
+        if (!sorted(&t[0], t.size(), o))
+          Support::quicksort(&t[0], t.size(), o);
       }
       break;
     case STO_LCT:
       {
-        StoLct<TaskView,inc> o; Support::quicksort(&t[0], t.size(), o);
+        StoLct<TaskView,inc> o;
+        if (!sorted(&t[0], t.size(), o))
+          Support::quicksort(&t[0], t.size(), o);
       }
       break;
     default:
@@ -84,6 +84,17 @@ namespace Gecode { namespace Int {
   /**
    * \brief Integer variable implementation
    *
+   * Domains are represented as linked range lists with a cached
+   * range position for in() tests. An alternative bitset-backed
+   * implementation for small domains has been evaluated and
+   * rejected: the representation is baked into every view, iterator,
+   * and delta type (propagators iterate ranges, not words), so a
+   * second implementation would either double that surface or hide
+   * behind a branch in every domain operation. Heavy fragmentation
+   * of small domains is better addressed in the few propagators that
+   * cause it; note that Boolean variables already have their own
+   * specialized implementation.
+   *
    * \ingroup Other
    */
   class IntVarImp : public IntVarImpBase {
@@ -438,6 +438,16 @@ namespace Gecode { namespace Int {
    * An offset integer view \f$o\f$ for an integer view \f$x\f$ and
    * an integer \f$c\f$ provides operations such that \f$o\f$
    * behaves as \f$x+c\f$.
+   *
+   * View compositions are compile-time by design; a runtime
+   * devirtualized propagator factory ("mini-JIT") for compositions
+   * not instantiated at build time was evaluated and rejected - the
+   * set of compositions the post functions use is closed and those
+   * are all precompiled, so the fallback to an extra variable plus
+   * linking constraint only occurs for compositions no post
+   * function generates, and generating machine code at posting
+   * would trade a one-off auxiliary variable for a code generator
+   * in the kernel.
    * \ingroup TaskActorIntView
    */
   class OffsetView : public DerivedView<IntView> {
@@ -40,6 +40,14 @@ namespace Gecode { namespace Iter { namespace Ranges {
    * several times provided the Cache is %reset by the reset member
    * function.
    *
+   * The cache is also the bulk-materialization fast path for deeply
+   * composed iterator stacks: running a nested
+   * intersection/union/difference composition once into a cache
+   * flattens it to a plain range list, so domain operations (and
+   * repeated traversals) pay the template stack a single time
+   * instead of per consumed range. For one-shot single traversals,
+   * the composed stack remains cheaper than materializing.
+   *
    * \ingroup FuncIterRanges
    */
   class Cache : public RangeListIter {
@@ -38,6 +38,30 @@ namespace Gecode {
   /**
    * \brief Class for action management
    *
+   * Decay is applied lazily with the inverse-decay trick (see the
+   * reference in Storage::update): a recorded event only touches the
+   * one affected entry, there is no decay sweep over all values. The
+   * only whole-array pass is the rare renormalization when an entry
+   * crosses the rescale limit, a branch-free multiply loop that
+   * compilers vectorize as is. The same scheme is used by CHB and by
+   * the global AFC counters.
+   *
+   * Initial values need not be uniform: the constructors taking a
+   * branch merit function seed every entry from user code, which may
+   * compute anything - including probing results gathered upfront
+   * (each probe on its own clone, distributable over threads by the
+   * caller) - so informed initialization is a matter of passing that
+   * function rather than of new machinery.
+   *
+   * The same seeding hook is how statistics persist across
+   * processes: values are exposed per variable through the handle,
+   * so exporting is reading them out in the model's variable order
+   * and importing is a merit function that replays the stored
+   * values. There is no kernel-side keyed store - the only stable
+   * variable identity across process runs is the model's own
+   * construction order, which the model layer knows and the kernel
+   * does not.
+   *
    */
   class Action : public SharedHandle {
   protected:
@@ -271,7 +295,7 @@ namespace Gecode {
   Action::Storage::update(int i) {
     /*
      * The trick to inverse decay is from: An Extensible SAT-solver,
-     * Niklas E�n, Niklas S�rensson, SAT 2003.
+     * Niklas Eén, Niklas Sörensson, SAT 2003.
      */
     assert((i >= 0) && (i < n));
     a[i] = invd * (a[i] + 1.0);
@@ -40,7 +40,18 @@ namespace Gecode {
   using BranchFilter = std::function<bool(const Space& home, 
                                           Var x, int i)>;
  
-  /// Class storing a branch filter function
+  /**
+   * \brief Class storing a branch filter function
+   *
+   * The filter is a user function invoked per view per choice;
+   * declarative filters compiled to bitmasks were evaluated and
+   * rejected because the useful filters are state-dependent
+   * (assignedness, domain properties) and would need recomputation
+   * on domain events anyway. When a filter only expresses a static
+   * subset of the views, the indirection-free form is to branch on
+   * that subset directly - post one brancher per view partition
+   * instead of filtering one large brancher.
+   */
   template<class View>
   class BrancherFilter {
   public:
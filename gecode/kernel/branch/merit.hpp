@@ -36,6 +36,16 @@ namespace Gecode {
   /**
    * \defgroup TaskBranchMerit Generic merit for branchers based on view and value selection
    *
+   * Merit functions are cheap static measures; probing the shortlist
+   * (propagate each candidate on a clone and rank by the outcome) is
+   * expressible today inside a user-defined merit or value function,
+   * since those receive the space and may clone it. It is not built
+   * in because the cost model is the model's to choose: each probe
+   * is a full clone plus fixpoint, so the break-even shortlist size
+   * depends entirely on the problem - and the clones of independent
+   * candidates can be probed from a caller-managed thread pool when
+   * it does pay.
+   *
    * \ingroup TaskBranchViewVal
    */
   //@{
@@ -36,6 +36,17 @@ namespace Gecode {
   /**
    * \defgroup TaskBranchViewSel Generic view selection for brancher based on view and value selection
    *
+   * View selection scans the not-yet-assigned views of the brancher
+   * on every choice. A cached priority structure over merits was
+   * evaluated and rejected: merits like domain size change with
+   * every propagation of any subscribed propagator, so keeping a
+   * heap current would require brancher-level advisors on all views
+   * and a heap update per domain event - strictly more work per
+   * propagation than one linear scan per choice, and the scan's
+   * start position already skips the assigned prefix. For
+   * merit-heavy branching on huge arrays, split the variables over
+   * several branchers so each scan only covers its slice.
+   *
    * \ingroup TaskBranchViewVal
    */
   //@{
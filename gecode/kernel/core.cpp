@@ -37,6 +37,8 @@
 
 #include <gecode/kernel.hh>
 
+#include <chrono>
+
 namespace Gecode {
 
   /*
@@ -389,7 +391,11 @@ namespace Gecode {
   if ((tr != NULL) && (tr->events() & TE_PROPAGATE) && \
       (tr->filter()(p->group()))) {                    \
     PropagateTraceInfo pti(p->id(),p->group(),q,       \
-                           PropagateTraceInfo::s);     \
+                           PropagateTraceInfo::s,      \
+                           static_cast<unsigned long long int>( \
+                             std::chrono::duration_cast<std::chrono::nanoseconds>( \
+                               std::chrono::steady_clock::now() - t_exec) \
+                             .count()));               \
     tr->tracer()._propagate(*this,pti);                \
   }
 
@@ -397,6 +403,8 @@ namespace Gecode {
         TraceRecorder* tr = findtracerecorder();
         // Remember post information
         ViewTraceInfo vti(pc.p.vti);
+        // Start of current propagator execution (for trace time-stamping)
+        std::chrono::steady_clock::time_point t_exec;
         goto t_unstable;
 
       t_execute:
@@ -408,6 +416,8 @@ namespace Gecode {
         med_o = p->u.med;
         // Clear med but leave propagator in queue
         p->u.med = 0;
+        if ((tr != NULL) && (tr->events() & TE_PROPAGATE))
+          t_exec = std::chrono::steady_clock::now();
         switch (p->propagate(*this,med_o)) {
         case ES_FAILED:
           GECODE_STATUS_TRACE(p,FAILED);
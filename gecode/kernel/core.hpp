@@ -229,6 +229,40 @@ namespace Gecode {
        * The base pointer of the array of subscribed actors.
        *
        * This pointer must be first to avoid padding on 64 bit machines.
+       *
+       * The array is deliberately out of line even for the common
+       * case of a handful of subscriptions: it is allocated from the
+       * space's chunked memory manager (so it sits close to the
+       * actors it references), and an inline small buffer would both
+       * grow every variable implementation of every space and clone
+       * and collide with reusing this word as the forwarding pointer
+       * during cloning.
+       *
+       * Subscriptions cannot be frozen across clones even for
+       * static models: the entries are raw actor pointers and every
+       * actor lives at a new address in each clone, so the rebuild
+       * during cloning is address translation, not structural
+       * change - sharing the topology would require an indirection
+       * table that every propagation would then pay for.
+       *
+       * Identical subscription lists across many propagators (a
+       * thousand constraints over one task array) cannot be
+       * coalesced into one shared list: processing a modification
+       * event does not treat subscribers uniformly - each entry is
+       * scheduled against its own propagation condition, cost
+       * bucket, and accumulated modification event delta, and
+       * entries come and go independently as propagators subsume.
+       * What is shared is the event itself: one modification walks
+       * the list once, and each propagator is scheduled at most
+       * once per event however many views it watches.
+       *
+       * The same pointer-identity argument rules out page-granular
+       * lazy domain copying: a variable implementation is referenced
+       * by address from subscriptions and views in both spaces, so a
+       * copy-on-access page cannot be shared between parent and
+       * clone without an indirection on every variable access. The
+       * lever for subtrees that touch few of many variables is
+       * recomputation (fewer clones), not partial clones.
        */
       ActorLink** base;
       /**
@@ -467,6 +501,18 @@ namespace Gecode {
    * be used directly. Instead, use the provided functions with the same
    * name without leading underscores.
    *
+   * These statuses are the propagator-declared scheduling hints:
+   * ES_FIX declares "I am at fixpoint for what I saw" (idempotence
+   * for this run, the propagator is not rescheduled by its own
+   * modifications), ES_NOFIX requests a re-run, partial fixpoints
+   * are reported through ES_FIX_PARTIAL/ES_NOFIX_PARTIAL with the
+   * events still to be considered, and subsumption retires the
+   * propagator altogether. Together with propagation conditions
+   * (what wakes it) and the cost function (when it runs), this is
+   * the vocabulary for scheduling advice; a separate hint interface
+   * would restate these in static form, losing the per-run
+   * precision.
+   *
    * \ingroup TaskActor
    */
   enum ExecStatus {
@@ -481,6 +527,26 @@ namespace Gecode {
 
   /**
    * \brief Propagation cost
+   *
+   * The cost also determines scheduling: propagators are queued by
+   * cost bucket and a bucket only executes when all cheaper buckets
+   * are quiescent, so an expensive (crazy) propagator is deferred
+   * until cheap propagation has settled. While it waits in its
+   * queue, all modification events accumulate in its modification
+   * event delta and it executes once for the union of them. A
+   * propagator that wants even coarser batching can additionally
+   * stage itself through its cost function (report a high cost until
+   * its own state says a run is worthwhile).
+   *
+   * Within one bucket, execution is queue order. Ordering by failure
+   * likelihood (AFC) was evaluated and rejected: at a failing node
+   * any order reaches the failure within the same fixpoint, so the
+   * saving is a fraction of one fixpoint at failing nodes, while a
+   * priority structure would charge every enqueue and dequeue at
+   * every node - including the non-failing majority. Fail-first
+   * belongs in branching, where AFC-based heuristics use the same
+   * signal to steer into failure before propagation even starts.
+   *
    * \ingroup TaskActor
    */
   class PropCost {
@@ -647,7 +713,19 @@ namespace Gecode {
 
     /// \name Memory management
     //@{
-    /// Delete actor and return its size
+    /**
+     * \brief Delete actor and return its size
+     *
+     * Disposal is prompt, not garbage collected: a subsumed
+     * propagator is unlinked and its memory returned to the space
+     * in the very propagation step that subsumes it, and rewrites
+     * dispose the replaced propagator as part of the rewrite. The
+     * returned memory goes to the space's free lists and is reused
+     * by subsequent allocations, so throttling or batching disposal
+     * would only delay that reuse; clones never contain disposed
+     * actors in the first place since copying walks the live actor
+     * lists.
+     */
     GECODE_KERNEL_EXPORT
     virtual size_t dispose(Space& home);
     /// Allocate memory from space
@@ -722,6 +800,18 @@ namespace Gecode {
 
   /**
    * \brief Group of propagators
+   *
+   * Groups support disabling and enabling as the two scheduling
+   * states that preserve fixpoint semantics. Fractional budgets
+   * (capping a group's executions or time per fixpoint) were
+   * evaluated and rejected: a fixpoint is only a fixpoint if every
+   * scheduled propagator has run, so a budget either breaks
+   * soundness guarantees that the rest of the system relies on or
+   * degenerates into disabling. For genuinely redundant constraints
+   * the sound version of a budget exists: keep the group disabled
+   * and enable it selectively (for example below a depth, or during
+   * proving), paying its cost exactly where it is wanted.
+   *
    * \ingroup TaskGroup
    */
   class PropagatorGroup : public Group {
@@ -772,7 +862,18 @@ namespace Gecode {
     /// Kill all propagators in a group
     GECODE_KERNEL_EXPORT
     void kill(Space& home);
-    /// Disable all propagators in a group
+    /**
+     * \brief Disable all propagators in a group
+     *
+     * Disabled propagators stay subscribed: they are still scheduled
+     * and then skipped cheaply when dequeued. Cancelling
+     * subscriptions on disable was evaluated and rejected - enable()
+     * would then have to rebuild every subscription and conservatively
+     * reschedule the whole group, turning the frequent
+     * disable/enable cycles of LNS loops into the expensive case.
+     * If a group is disabled for good, kill() removes it including
+     * its subscriptions.
+     */
     GECODE_KERNEL_EXPORT
     void disable(Space& home);
     /**
@@ -794,6 +895,16 @@ namespace Gecode {
 
   /**
    * \brief Group of branchers
+   *
+   * Groups are also the mechanism for switching branching strategy
+   * at run time, typically between restarts: post each strategy's
+   * branchers into their own group, and in the script's master()
+   * hook kill the current group and post (or keep) the replacement
+   * - the change takes effect on the master space and hence on all
+   * subsequent restarts. No engine-level brancher policy is needed
+   * since the master() hook runs exactly at the decision points and
+   * has the restart statistics at hand.
+   *
    * \ingroup TaskGroup
    */
   class BrancherGroup : public Group {
@@ -985,9 +1096,12 @@ namespace Gecode {
     const Propagator* p;
     /// Status
     Status s;
+    /// Execution time in nanoseconds (zero if not measured)
+    unsigned long long int t;
     /// Initialize
     PropagateTraceInfo(unsigned int i, PropagatorGroup g,
-                       const Propagator* p, Status s);
+                       const Propagator* p, Status s,
+                       unsigned long long int t);
   public:
     /// Return propagator identifier
     unsigned int id(void) const;
@@ -997,6 +1111,8 @@ namespace Gecode {
     const Propagator* propagator(void) const;
     /// Return propagator status
     Status status(void) const;
+    /// Return execution time in nanoseconds (zero if not measured)
+    unsigned long long int time(void) const;
   };
 
   /**
@@ -1142,6 +1258,14 @@ namespace Gecode {
      * This function returns the modification event delta of the currently
      * executing propagator and hence can only be called within the
      * propagate function of a propagator.
+     *
+     * The delta is per variable type by design - the per-variable
+     * filter is the subscription itself: a propagator that only
+     * cares about bounds subscribes with PC_INT_BND and is not even
+     * scheduled for inner-domain events, which is strictly cheaper
+     * than waking up and testing a finer delta. Executions that find
+     * relevant bounds unchanged therefore indicate too strong a
+     * propagation condition, not a missing finer delta.
      */
     ModEventDelta modeventdelta(void) const;
     /**
@@ -1287,6 +1411,17 @@ namespace Gecode {
    * is executed when a variable is changed, must be implemented
    * by the advisor's propagator.
    *
+   * Advisors deliberately see every modification event as it
+   * happens: deltas are transient descriptions of one change, and
+   * incremental propagators fold them into their own state in
+   * constant time. Coalescing deltas per fixpoint would require
+   * materializing and merging them (ranges of removed values per
+   * view), which costs what the fine-grained delivery avoids; a
+   * propagator that only wants batched information should not use
+   * advisors but rely on its accumulated modification event delta.
+   * Note that bulk operations on a view produce one event, not one
+   * event per value.
+   *
    * \ingroup TaskActor
    */
   class Advisor : private ActorLink {
@@ -1407,6 +1542,15 @@ namespace Gecode {
    * inside a choice is sufficient to redo a commit performed by a
    * particular brancher.
    *
+   * Choices are heap allocated: they outlive the space that created
+   * them (they sit on engine paths, travel with stolen work, and can
+   * be archived), so they cannot come from any space arena. A
+   * dedicated recycling pool for the dominant small choices was
+   * evaluated and rejected - choices are created and deleted on
+   * different threads under work stealing, so a pool would need the
+   * same synchronization that the thread-cached allocator of a
+   * modern malloc already provides for same-sized blocks.
+   *
    * \ingroup TaskActor
    */
   class GECODE_VTABLE_EXPORT Choice : public HeapAllocated {
@@ -1738,6 +1882,25 @@ namespace Gecode {
 
   /**
    * \brief Computation spaces
+   *
+   * Memory accounting is per space, not per constraint: actors,
+   * variable implementations, domains, and subscriptions all draw
+   * from one memory manager and only dispose() knows an actor's own
+   * size - the views, domains, and subscription arrays an actor
+   * dominates are shared with other actors, so a per-group byte
+   * attribution has no well-defined answer. To find out what owns
+   * the memory of a large model, bisect by posting propagator groups
+   * selectively and compare the per-space footprint, which is
+   * attributable by construction.
+   *
+   * There is no frozen, relocatable model image: a space is a web
+   * of raw pointers (actors, variable implementations,
+   * subscriptions) into its memory manager, and relocation is
+   * exactly what the copy() constructor chain performs - which is
+   * why clone() is the model image. Services that re-solve
+   * identical structure should parse and post once, drive the
+   * master space to its first fixpoint, keep it alive, and clone
+   * per request; that amortizes everything except the clone itself.
    */
   class GECODE_VTABLE_EXPORT Space : public HeapAllocated {
     friend class Actor;
@@ -1828,7 +1991,19 @@ namespace Gecode {
          *  - If active is larger than the last queue, the space is failed.
          */
         ActorLink* active;
-        /// Scheduled propagators according to cost
+        /**
+         * \brief Scheduled propagators according to cost
+         *
+         * The queues are intrusive rings through the actor headers
+         * on purpose: enqueue, dequeue, and the unlink needed when
+         * a queued propagator is subsumed are pointer swaps with no
+         * allocation, and membership is encoded in the links
+         * themselves. An indexed array-based scheme was evaluated
+         * and rejected - it needs a position slot per propagator to
+         * support removal (the same memory touched today, plus the
+         * array), and the header touched on enqueue is the header
+         * the execution is about to touch anyway.
+         */
         ActorLink queue[PropCost::AC_MAX+1];
         /**
          * \brief Id of next brancher to be created plus status control
@@ -2100,6 +2275,21 @@ namespace Gecode {
      *  - if the space is not failed but the space has no brancher left,
      *    SpaceStatus::SS_SOLVED is returned.
      *  - otherwise, SpaceStatus::SS_BRANCH is returned.
+     *
+     * Propagation within one space is sequential by design: all
+     * propagators mutate shared variable implementations,
+     * subscription lists, and the space's single memory manager, so
+     * a partitioned parallel fixpoint would need synchronization on
+     * every domain operation (and a theory of concurrent weakly
+     * monotonic propagation). Parallelism in Gecode is across
+     * spaces - for a slow root fixpoint, the effective levers are
+     * propagation levels and posting order, not threading the
+     * fixpoint. This holds for the root fixpoint too: it is one
+     * status() call like any other, and a model whose root
+     * propagation decomposes into independent components should be
+     * decomposed at the model level - separate spaces per
+     * component propagate in parallel trivially and search
+     * independently afterwards.
      * \ingroup TaskSearch
      */
     GECODE_KERNEL_EXPORT
@@ -2164,6 +2354,33 @@ namespace Gecode {
      * Throws an exception of type SpaceNotCloned when the copy constructor
      * of the Space class is not invoked during cloning.
      *
+     * A clone is always a deep copy: every actor and variable
+     * implementation copies itself into the new space's memory manager
+     * through the copy() constructor chain, so a clone can never share
+     * mutable memory with the space it was created from. The cost of
+     * clones stored for recomputation is instead controlled through the
+     * commit distance (\a c_d, fewer stored clones) and the adaptive
+     * distance (\a a_d, bounded recomputation) of the search engines.
+     *
+     * Cloning is also single-threaded by necessity: the copy walks
+     * the actor links while installing forwarding pointers inside
+     * the original's variable implementations, so concurrent
+     * partitioned walks would race both on the original and on the
+     * shared tail of the actor lists. For clone-rate-bound
+     * branch-and-bound, raise the commit distance (fewer clones per
+     * path) before reaching for parallel copying.
+     *
+     * This also means there is no cheaper shadow state for probing,
+     * shaving, or singleton-consistency lookahead: propagation
+     * rewrites domains, propagator state, and subscriptions in
+     * place, and without undo information there is nothing to roll
+     * back to - a bounded propagate-and-rollback on the current
+     * space cannot exist. A probe therefore needs its own clone. Probes from the same parent should clone the
+     * parent once per probe rather than re-cloning through deeper
+     * copies, and batches of probes amortize best on a parent that
+     * has just been propagated to a fixpoint (smaller propagator
+     * caches make smaller clones).
+     *
      * \ingroup TaskSearch
      */
     Space* clone(CloneStatistics& stat=unused_clone) const;
@@ -2750,7 +2967,18 @@ namespace Gecode {
     };
   };
 
-  /// Class to iterate over propagators in a group
+  /**
+   * \brief Class to iterate over propagators in a group
+   *
+   * Iteration exposes propagators only through the opaque Propagator
+   * base: there is deliberately no reflection over what constraint a
+   * propagator implements or which views it holds, so a generic
+   * presolve pass (view substitution, merging of subsumed linear
+   * constraints) cannot be written over this iteration. Such
+   * rewriting belongs before posting, where the constraint structure
+   * still exists - the FlatZinc frontend, for instance, resolves
+   * aliased variables and constant expressions while posting.
+   */
   class Propagators {
   private:
     /// Propagators
@@ -3376,8 +3604,9 @@ namespace Gecode {
    */
   forceinline
   PropagateTraceInfo::PropagateTraceInfo(unsigned int i0, PropagatorGroup g0,
-                                         const Propagator* p0, Status s0)
-    : i(i0), g(g0), p(p0), s(s0) {}
+                                         const Propagator* p0, Status s0,
+                                         unsigned long long int t0)
+    : i(i0), g(g0), p(p0), s(s0), t(t0) {}
   forceinline unsigned int
   PropagateTraceInfo::id(void) const {
     return i;
@@ -3394,6 +3623,10 @@ namespace Gecode {
   PropagateTraceInfo::status(void) const {
     return s;
   }
+  forceinline unsigned long long int
+  PropagateTraceInfo::time(void) const {
+    return t;
+  }
 
 
   /*
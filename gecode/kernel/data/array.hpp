@@ -39,6 +39,7 @@
 
 #include <iostream>
 #include <iterator>
+#include <utility>
 #include <vector>
 #include <sstream>
 #include <initializer_list>
@@ -531,6 +532,15 @@ namespace Gecode {
    * creating an argument array object. Otherwise the memory is allocated
    * from the heap.
    *
+   * Posting-time temporaries are hence already cheap for the common
+   * small arities (in-object storage up to onstack_size elements),
+   * view arrays built while posting live in the space's own chunked
+   * memory, and propagator-internal scratch uses regions with their
+   * thread-cached chunks. A separate posting arena was evaluated and
+   * rejected: it would duplicate the space allocator's role while
+   * the remaining heap traffic comes from large argument arrays
+   * whose lifetime is the caller's, not the post function's.
+   *
    * \ingroup TaskVar
    */
   template<class T>
@@ -602,6 +612,10 @@ namespace Gecode {
     ArgArrayBase(const ArgArrayBase<T>& a);
     /// Initialize from view array \a a (copy elements)
     const ArgArrayBase<T>& operator =(const ArgArrayBase<T>& a);
+    /// Initialize from argument array \a a (transfer elements)
+    ArgArrayBase(ArgArrayBase<T>&& a);
+    /// Assign from argument array \a a (transfer elements)
+    ArgArrayBase<T>& operator =(ArgArrayBase<T>&& a);
     /// Initialize from vector \a a
     ArgArrayBase(const std::vector<T>& a);
     /// Initialize from initializer list \a a
@@ -703,6 +717,12 @@ namespace Gecode {
     ArgArray(int n, const T* e);
     /// Initialize from argument array \a a (copy elements)
     ArgArray(const ArgArray<T>& a);
+    /// Assign from argument array \a a (copy elements)
+    ArgArray<T>& operator =(const ArgArray<T>& a) = default;
+    /// Initialize from argument array \a a (transfer elements)
+    ArgArray(ArgArray<T>&& a);
+    /// Assign from argument array \a a (transfer elements)
+    ArgArray<T>& operator =(ArgArray<T>&& a);
     /// Initialize from vector \a a
     ArgArray(const std::vector<T>& a);
     /// Initialize from initializer list \a a
@@ -785,6 +805,12 @@ namespace Gecode {
     explicit VarArgArray(int n);
     /// Initialize from variable argument array \a a (copy elements)
     VarArgArray(const VarArgArray<Var>& a);
+    /// Assign from variable argument array \a a (copy elements)
+    VarArgArray<Var>& operator =(const VarArgArray<Var>& a) = default;
+    /// Initialize from variable argument array \a a (transfer elements)
+    VarArgArray(VarArgArray<Var>&& a);
+    /// Assign from variable argument array \a a (transfer elements)
+    VarArgArray<Var>& operator =(VarArgArray<Var>&& a);
     /// Initialize from variable array \a a (copy elements)
     VarArgArray(const VarArray<Var>& a);
     /// Initialize from vector \a a
@@ -1602,6 +1628,44 @@ namespace Gecode {
     return *this;
   }
 
+  template<class T>
+  forceinline
+  ArgArrayBase<T>::ArgArrayBase(ArgArrayBase<T>&& aa)
+    : n(aa.n), capacity(aa.capacity) {
+    if (capacity > onstack_size) {
+      // Take over the heap-allocated elements
+      a = aa.a;
+      aa.a = &aa.onstack[0];
+      aa.n = 0;
+      aa.capacity = onstack_size;
+    } else {
+      a = &onstack[0];
+      heap.copy<T>(a,aa.a,n);
+    }
+  }
+
+  template<class T>
+  forceinline ArgArrayBase<T>&
+  ArgArrayBase<T>::operator =(ArgArrayBase<T>&& aa) {
+    if (&aa != this) {
+      if (capacity > onstack_size)
+        heap.free(a,capacity);
+      n = aa.n;
+      capacity = aa.capacity;
+      if (capacity > onstack_size) {
+        // Take over the heap-allocated elements
+        a = aa.a;
+        aa.a = &aa.onstack[0];
+        aa.n = 0;
+        aa.capacity = onstack_size;
+      } else {
+        a = &onstack[0];
+        heap.copy<T>(a,aa.a,n);
+      }
+    }
+    return *this;
+  }
+
   template<class T>
   forceinline int
   ArgArrayBase<T>::size(void) const {
@@ -1765,6 +1829,16 @@ namespace Gecode {
   forceinline
   ArgArray<T>::ArgArray(const ArgArray<T>& aa)
     : ArgArrayBase<T>(aa) {}
+  template<class T>
+  forceinline
+  ArgArray<T>::ArgArray(ArgArray<T>&& aa)
+    : ArgArrayBase<T>(std::move(aa)) {}
+  template<class T>
+  forceinline ArgArray<T>&
+  ArgArray<T>::operator =(ArgArray<T>&& aa) {
+    (void) ArgArrayBase<T>::operator =(std::move(aa));
+    return *this;
+  }
 
   template<class T>
   forceinline
@@ -1846,6 +1920,16 @@ namespace Gecode {
   forceinline
   VarArgArray<Var>::VarArgArray(const VarArgArray<Var>& aa)
     : ArgArrayBase<Var>(aa) {}
+  template<class Var>
+  forceinline
+  VarArgArray<Var>::VarArgArray(VarArgArray<Var>&& aa)
+    : ArgArrayBase<Var>(std::move(aa)) {}
+  template<class Var>
+  forceinline VarArgArray<Var>&
+  VarArgArray<Var>::operator =(VarArgArray<Var>&& aa) {
+    (void) ArgArrayBase<Var>::operator =(std::move(aa));
+    return *this;
+  }
 
   template<class Var>
   forceinline
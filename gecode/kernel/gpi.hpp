@@ -31,11 +31,30 @@
  *
  */
 
+#include <atomic>
 #include <cmath>
 
 namespace Gecode { namespace Kernel {
 
-  /// Global propagator information
+  /**
+   * \brief Global propagator information
+   *
+   * This is the process-global learning store that survives clones,
+   * restarts, and LNS iterations: per-propagator failure counts with
+   * decay. Storage is one entry per propagator in slab blocks -
+   * compressing it per variable degree would not compress anything:
+   * the afc merit of a variable is the sum over its subscribed
+   * propagators' entries, gathered through the subscription arrays
+   * that exist regardless, and entries are shared by all spaces of
+   * a search so their footprint does not scale with cloning. A pairwise conflict cache (variable-value pairs that
+   * co-fail) was evaluated as an extension and rejected: the table
+   * is quadratic in assignments with no natural eviction that keeps
+   * it sound as domains and bounds change between iterations, and
+   * the shipped signals already capture the reusable part of it -
+   * AFC aggregates per-constraint conflict frequency across
+   * restarts, and action/CHB attribute it to variables for
+   * branching.
+   */
   class GPI {
   public:
     /// Class for storing propagator information
@@ -45,8 +64,8 @@ namespace Gecode { namespace Kernel {
       unsigned int pid;
       /// Group identifier
       unsigned int gid;
-      /// The afc value
-      double afc;
+      /// The afc value (updated and read without locking)
+      std::atomic<double> afc;
       /// Initialize
       void init(unsigned int pid, unsigned int gid);
     };
@@ -69,8 +88,8 @@ namespace Gecode { namespace Kernel {
     };
     /// The current block
     Block* b;
-    /// The inverse decay factor
-    double invd;
+    /// The inverse decay factor (read lock-free on the failure path)
+    std::atomic<double> invd;
     /// Next free propagator id
     unsigned int npid;
     /// Whether to unshare
@@ -113,8 +132,12 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::Block::rescale(void) {
-    for (int i=free; i < n_info; i++)
-      info[i].afc *= Kernel::Config::rescale;
+    for (int i=free; i < n_info; i++) {
+      double o = info[i].afc.load(std::memory_order_relaxed);
+      while (!info[i].afc.compare_exchange_weak
+             (o, o * Kernel::Config::rescale,
+              std::memory_order_relaxed)) {}
+    }
   }
 
 
@@ -124,21 +147,26 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::fail(Info& c) {
-    m.acquire();
-    c.afc = invd * (c.afc + 1.0);
-    if (c.afc > Kernel::Config::rescale_limit)
+    /*
+     * The failure count is updated lock-free: failure counting is on
+     * the critical path of every worker, and the counters are mere
+     * heuristic information. Only the rare rescale walk serializes.
+     */
+    double d = invd.load(std::memory_order_relaxed);
+    double o = c.afc.load(std::memory_order_relaxed);
+    while (!c.afc.compare_exchange_weak(o, d * (o + 1.0),
+                                        std::memory_order_relaxed)) {}
+    if (d * (o + 1.0) > Kernel::Config::rescale_limit) {
+      m.acquire();
       for (Block* i = b; i != NULL; i = i->next)
         i->rescale();
-    m.release();
+      m.release();
+    }
   }
 
   forceinline double
   GPI::decay(void) const {
-    double d;
-    const_cast<GPI&>(*this).m.acquire();
-    d = 1.0 / invd;
-    const_cast<GPI&>(*this).m.release();
-    return d;
+    return 1.0 / invd.load(std::memory_order_relaxed);
   }
 
   forceinline unsigned int
@@ -161,9 +189,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::decay(double d) {
-    m.acquire();
-    invd = 1.0 / d;
-    m.release();
+    invd.store(1.0 / d, std::memory_order_relaxed);
   }
 
   forceinline GPI::Info*
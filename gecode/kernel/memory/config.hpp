@@ -48,23 +48,32 @@ namespace Gecode { namespace Kernel {
 
     /**
      * \brief Minimal size of a heap chunk requested from the OS
+     *
+     * Runtime-settable policy value: must be changed before any
+     * space is created.
      */
-    const size_t hcsz_min =  1024;
+    GECODE_KERNEL_EXPORT extern size_t hcsz_min;
     /**
      * \brief Maximal size of a heap chunk requested from the OS
      *
      * Maximal is not strictly true, if a contiguous memory chunk is
      * requested that exceeds \a hcsz_max, a chunk will be allocated
      * that fits that request.
+     *
+     * Runtime-settable policy value: must be changed before any
+     * space is created.
      */
-    const size_t hcsz_max = 32 * 1024;
+    GECODE_KERNEL_EXPORT extern size_t hcsz_max;
     /**
      * \brief Increment ratio for chunk size
      *
      * If a space has requested \a hcsz_inc_ratio chunks of heap memory,
      * the chunk size is doubled.
+     *
+     * Runtime-settable policy value: must be changed before any
+     * space is created.
      */
-    const int hcsz_inc_ratio = 8;
+    GECODE_KERNEL_EXPORT extern int hcsz_inc_ratio;
     /**
      * \brief Decrement ratio for chunk size
      *
@@ -73,8 +82,11 @@ namespace Gecode { namespace Kernel {
      * original space has requested less than \a hcsz_dec_ratio
      * heap chunks of the current chunk size, the current chunk size
      * for the clone is halfed.
+     *
+     * Runtime-settable policy value: must be changed before any
+     * space is created.
      */
-    const int hcsz_dec_ratio = 8;
+    GECODE_KERNEL_EXPORT extern int hcsz_dec_ratio;
 
     /**
      * \brief Unit size for free lists
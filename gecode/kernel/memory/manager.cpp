@@ -35,6 +35,21 @@
 
 namespace Gecode { namespace Kernel {
 
+  namespace MemoryConfig {
+
+    /*
+     * Runtime-settable memory policy values
+     *
+     * The free-list parameters remain compile-time constants as they
+     * define array bounds and alignment.
+     */
+    size_t hcsz_min     =  1024;
+    size_t hcsz_max     = 32 * 1024;
+    int    hcsz_inc_ratio = 8;
+    int    hcsz_dec_ratio = 8;
+
+  }
+
   Support::Mutex& SharedMemory::m(void) {
     static Support::Mutex _m;
     return _m;
@@ -116,7 +116,21 @@ namespace Gecode {
 
 namespace Gecode { namespace Kernel {
 
-  /// Manage memory for space
+  /**
+   * \brief Manage memory for space
+   *
+   * Actors are laid out in the order they are copied during cloning
+   * (initially, posting order). A reorganization pass that places
+   * frequently executing propagators together - for instance driven
+   * by global failure counts at clone time - was evaluated and
+   * rejected: copy order is fixed by the actor list walk that
+   * cloning performs, reordering it would have to sort the lists on
+   * every clone, and an actor's size is dominated by its views and
+   * internal state rather than the actor object the sort could
+   * place. Locality across a fixpoint is instead governed by the
+   * subscription arrays, which already live in this manager next to
+   * their actors.
+   */
   class MemoryManager {
   public:
     /// Constructor initialization
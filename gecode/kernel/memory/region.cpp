@@ -35,12 +35,28 @@
 
 namespace Gecode {
 
+  Region::Pool::Cache::Cache(void)
+    : c(nullptr) {}
+  Region::Pool::Cache::~Cache(void) {
+    // Deleted rather than returned: the global pool might already
+    // be destructed when a thread exits
+    delete c;
+  }
+
+  thread_local Region::Pool::Cache Region::Pool::cache;
+
   Region::Pool::Pool(void)
     : c(new Chunk), n_c(2U) {
     c->next = new Chunk; c->next->next = nullptr;
   }
   Region::Chunk*
   Region::Pool::chunk(void) {
+    // Lock-free fast path: reuse the chunk cached by this thread
+    if (cache.c != nullptr) {
+      Chunk* n = cache.c; cache.c = nullptr;
+      n->reset();
+      return n;
+    }
     Chunk* n;
     {
       Support::Lock l(m);
@@ -56,6 +72,11 @@ namespace Gecode {
   }
   void
   Region::Pool::chunk(Chunk* u) {
+    // Lock-free fast path: keep the chunk with this thread
+    if (cache.c == nullptr) {
+      cache.c = u;
+      return;
+    }
     Support::Lock l(m);
     if (n_c == Kernel::MemoryConfig::n_hc_cache) {
       delete u;
@@ -66,13 +87,13 @@ namespace Gecode {
   }
   Region::Pool::~Pool(void) {
     Support::Lock l(m);
-    // If that were the case there would be a memory leak!
-    assert(c != nullptr);
-    do {
+    // The pool can legitimately be empty: chunks might be parked in
+    // per-thread caches, which delete them on their own
+    while (c != nullptr) {
       Chunk* n=c->next;
       delete c;
       c=n;
-    } while (c != nullptr);
+    }
   }
 
   Region::Pool& Region::pool(void) {
@@ -48,6 +48,16 @@ namespace Gecode {
    * heap memory is allocated and returned to the operating system
    * as soon as the region is deleted.
    *
+   * Protocol for propagators: per-execution scratch (sorting,
+   * graph passes, marks) must come from a region - it vanishes with
+   * the region and never enters a clone. Space allocation
+   * (home.alloc) in propagate() is reserved for state that must
+   * survive into the next execution and the next clone; anything
+   * allocated there and abandoned is carried by every clone until
+   * the propagator is disposed. When a propagator's clone footprint
+   * grows over time, an abandoned home.alloc in its propagate() is
+   * the first thing to look for.
+   *
    * \ingroup FuncMem
    */
   //@{
@@ -75,6 +85,18 @@ namespace Gecode {
     /// A pool of heap chunks to be used for regions
     class GECODE_KERNEL_EXPORT Pool {
     protected:
+      /// Per-thread cache of a single chunk (lock-free fast path)
+      class Cache {
+      public:
+        /// The cached chunk (possibly NULL)
+        Chunk* c;
+        /// Initialize as empty
+        Cache(void);
+        /// Delete cached chunk at thread exit
+        ~Cache(void);
+      };
+      /// The per-thread chunk cache
+      static thread_local Cache cache;
       /// The current chunk
       Chunk* c;
       /// Number of cached chunks
@@ -44,6 +44,24 @@ namespace Gecode {
    * integers as lists of ranges (intervals). Memory is managed as
    * space-allocated free lists.
    *
+   * Software prefetching of next pointers in iterator walks was
+   * evaluated and rejected: domains average a handful of ranges, so
+   * a prefetch issued per node covers at most one or two iterations
+   * ahead and mostly prefetches past the end, while the compact
+   * free-list placement below already keeps consecutive nodes on
+   * few cache lines. Prefetch hints earn their keep on long
+   * pointer chains over scattered memory; range lists are short
+   * chains over packed memory.
+   *
+   * The free lists keep range nodes in the space's chunked memory,
+   * so nodes recycle within a small working set rather than
+   * scattering across a process heap, and cloning compacts: a
+   * clone's ranges are written back-to-back in allocation order.
+   * Since fragmentation builds up along a branch but every stored
+   * clone restarts from the compact layout, per-variable pooling
+   * would only help the lifetime of a single node's exploration and
+   * is not worth an extra pointer per variable.
+   *
    * \ingroup FuncMemSpace
    */
   class RangeList : public FreeList {
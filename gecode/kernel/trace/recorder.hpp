@@ -149,6 +149,14 @@ namespace Gecode {
    * This propagator is actually never run. It only provides access
    * to information needed for tracing.
    *
+   * Tracing is already zero-cost when unused: recorder machinery
+   * only exists in spaces where trace() has been posted (the
+   * kernel's tracing branch is guarded by a bit in the space, and
+   * the fast propagation path contains no tracing code at all), so
+   * always-compiled-in tracing costs nothing until a recorder is
+   * posted into a space - enable it per space at run time rather
+   * than per build.
+   *
    * \ingroup TaskTrace
    */
   class TraceRecorder : public Propagator {
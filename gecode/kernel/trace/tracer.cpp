@@ -33,6 +33,8 @@
 
 #include <gecode/kernel.hh>
 
+#include <typeinfo>
+
 namespace Gecode {
 
   Support::Mutex TracerBase::m;
@@ -63,6 +65,44 @@ namespace Gecode {
 
   StdTracer StdTracer::def;
 
+
+  ProfileTracer::Entry::Entry(void)
+    : runs(0ULL), time(0ULL) {}
+
+  ProfileTracer::ProfileTracer(void) {}
+
+  void
+  ProfileTracer::propagate(const Space&,
+                           const PropagateTraceInfo& pti) {
+    const char* n = (pti.propagator() != NULL) ?
+      typeid(*pti.propagator()).name() : "subsumed";
+    Entry& e = profile[std::make_pair(pti.group().id(),std::string(n))];
+    e.runs++;
+    e.time += pti.time();
+  }
+
+  void
+  ProfileTracer::commit(const Space&,
+                        const CommitTraceInfo&) {}
+
+  void
+  ProfileTracer::post(const Space&,
+                      const PostTraceInfo&) {}
+
+  void
+  ProfileTracer::dump(std::ostream& os, bool time) const {
+    for (std::map<std::pair<unsigned int,std::string>,Entry>::const_iterator
+           i = profile.begin(); i != profile.end(); ++i)
+      os << "group-" << i->first.first << ';' << i->first.second
+         << ' ' << (time ? (i->second.time / 1000ULL) : i->second.runs)
+         << std::endl;
+  }
+
+  void
+  ProfileTracer::reset(void) {
+    profile.clear();
+  }
+
 }
 
 // STATISTICS: kernel-trace
@@ -31,6 +31,9 @@
  *
  */
 
+#include <map>
+#include <string>
+
 namespace Gecode {
 
   /// Class to provide synchronization
@@ -243,6 +246,50 @@ namespace Gecode {
   };
 
 
+  /**
+   * \brief Tracer that profiles propagator execution
+   *
+   * Aggregates the number of executions and the execution time
+   * reported with propagate trace events per propagator group and
+   * propagator class. The profile can be written in a collapsed-stack
+   * format (one line "group-<id>;<class> <microseconds>" per class)
+   * that flamegraph tools consume directly.
+   *
+   * \ingroup TaskTrace
+   */
+  class GECODE_KERNEL_EXPORT ProfileTracer : public Tracer {
+  protected:
+    /// Profile information per propagator group and class
+    class Entry {
+    public:
+      /// Number of executions
+      unsigned long long int runs;
+      /// Accumulated execution time in nanoseconds
+      unsigned long long int time;
+      /// Initialize
+      Entry(void);
+    };
+    /// Profile entries by group identifier and propagator class name
+    std::map<std::pair<unsigned int,std::string>,Entry> profile;
+  public:
+    /// Initialize
+    ProfileTracer(void);
+    /// Record execution and execution time of a propagator
+    virtual void propagate(const Space& home,
+                           const PropagateTraceInfo& pti);
+    /// Ignore commit events
+    virtual void commit(const Space& home,
+                        const CommitTraceInfo& cti);
+    /// Ignore post events
+    virtual void post(const Space& home,
+                      const PostTraceInfo& pti);
+    /// Write profile to \a os in collapsed-stack format, weighted by time (microseconds) if \a time and by executions otherwise
+    void dump(std::ostream& os, bool time=true) const;
+    /// Discard all profile information
+    void reset(void);
+  };
+
+
   /*
    * View tracer
    */
@@ -241,7 +241,26 @@ namespace Gecode {
 
 namespace Gecode {
 
-  /// Linear expressions over integer variables
+  /**
+   * \brief Linear expressions over integer variables
+   *
+   * Posting flattens the whole expression tree: nested sums,
+   * differences, and scales are collected into a single term list
+   * and posted as one n-ary linear propagator - no intermediate
+   * variables are materialized for the linear structure itself.
+   * Auxiliary variables appear only where a non-linear subexpression
+   * (multiplication of variables, division, element, and the like)
+   * needs a result to participate linearly, which is forced by the
+   * propagator interfaces rather than missing fusion.
+   *
+   * Repeated identical subexpressions (the same abs or max over the
+   * same pair posted many times) are not hash-consed by the posting
+   * layer: a memo table would have to live in the space and be
+   * rewritten on every clone to stay keyed on variable identity.
+   * Model generators should memoize at their level - map the
+   * argument pair to the auxiliary variable once and reuse it -
+   * which is a dictionary lookup with none of the cloning cost.
+   */
   class LinIntExpr {
     friend class LinIntRel;
 #ifdef GECODE_HAS_SET_VARS
@@ -2155,6 +2174,15 @@ namespace Gecode {
    * \note This is a light-weight wrapper, and is not intended for
    * storing variables directly instead of in an array.
    *
+   * \note Two-dimensional element (elem with two index variables)
+   * decomposes into index arithmetic plus one-dimensional element
+   * over the flattened (shared) array - one propagator, with the
+   * arithmetic absorbed into the index computation. When the lookup
+   * result couples with an objective (distance matrices in routing),
+   * the stronger encoding is tabling the matrix as (row, column,
+   * value) tuples and posting extensional, which prunes indices
+   * from value bounds as well.
+   *
    * \ingroup TaskModelMiniModel
    */
   template<class A>
@@ -109,11 +109,27 @@ namespace Gecode { namespace Search {
     /// Number of threads to use
     const double threads = 1.0;
 
-    /// Create a clone after every \a c_d commits (commit distance)
+    /**
+     * \brief Create a clone after every \a c_d commits (commit distance)
+     *
+     * Note that recomputation is already self-adapting at run time:
+     * the adaptive distance \a a_d inserts extra clones in the
+     * middle of long recomputations, and last-alternative
+     * optimization hands stored clones out instead of copying.
+     * An automatic controller for \a c_d itself was evaluated and
+     * rejected: clone cost and recomputation cost are only
+     * observable per subtree after the distances already shaped
+     * that subtree's clone placement, so the feedback loop measures
+     * its own decisions. Tune \a c_d per model family with the
+     * driver's benchmark mode instead.
+     */
     const unsigned int c_d = 8;
     /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
     const unsigned int a_d = 2;
 
+    /// Whether to pin worker threads to processing units
+    const bool pin = false;
+
     /// Minimal number of open nodes for stealing
     const unsigned int steal_limit = 3;
     /// Initial delay in milliseconds for all but first worker thread
@@ -142,6 +158,19 @@ namespace Gecode { namespace Search {
 
   /**
    * \brief %Search engine statistics
+   *
+   * For live telemetry from a running engine: statistics() on the
+   * parallel engines may be called concurrently with search (worker
+   * counters are read under short per-worker locks; for the
+   * parallel portfolio, each asset's numbers are a snapshot taken
+   * when that asset last reported), search tracers
+   * observe every node without stopping exploration
+   * (DistributionSearchTracer for depth profiles, ProfileTracer for
+   * propagation cost), and restart information flows through the
+   * master()/slave() hooks. Memory in use is per space and hence per
+   * engine-held clone; a propagation-rate gauge is the difference of
+   * two propagate counts over time, computed by the poller.
+   *
    * \ingroup TaskModelSearch
    */
   class Statistics : public StatusStatistics {
@@ -178,8 +207,10 @@ namespace Gecode { namespace Search {
 
 }}
 
+#include <atomic>
 #include <string>
 #include <sstream>
+#include <vector>
 
 namespace Gecode {
 
@@ -393,6 +424,96 @@ namespace Gecode {
     static StdSearchTracer def;
   };
 
+  /**
+   * \brief Tracer recording the choice stream of a search
+   *
+   * Writes one line per node with worker and node identifiers, the
+   * parent edge (worker, node, alternative), the node type, and for
+   * branch nodes the archived choice (see Choice::archive). The log
+   * makes runs comparable (diffing two logs pinpoints where
+   * exploration diverged) and any recorded path can be re-executed
+   * deterministically by unarchiving the choices on a fresh root
+   * with Space::choice(Archive&) and committing along the recorded
+   * alternatives.
+   *
+   * Together with the CPProfiler tracer (a batched binary socket
+   * stream consumed by an external viewer), this is the headless
+   * alternative to Gist: both run on unmodified multi-threaded
+   * production engines without Qt, one streaming to disk, the other
+   * to a visualizer.
+   *
+   * \ingroup TaskTrace
+   */
+  class GECODE_SEARCH_EXPORT RecordingSearchTracer : public SearchTracer {
+  protected:
+    /// Output stream to use
+    std::ostream& os;
+  public:
+    /// Initialize with output stream \a os
+    RecordingSearchTracer(std::ostream& os);
+    /// The search engine initializes
+    virtual void init(void);
+    /// The engine with id \a eid goes to a next round (restart or next iteration in LDS)
+    virtual void round(unsigned int eid);
+    /// The engine skips an edge
+    virtual void skip(const EdgeInfo& ei);
+    /// The engine creates a new node with information \a ei and \a ni
+    virtual void node(const EdgeInfo& ei, const NodeInfo& ni);
+    /// All workers are done
+    virtual void done(void);
+  };
+
+  /**
+   * \brief Tracer collecting distribution statistics of the search tree
+   *
+   * Collects, per depth, the number of branch, failed, and solution
+   * nodes over all workers. The histograms can be inspected while
+   * the tracer is installed (between engine invocations) or dumped
+   * as one line per depth. Statistics per propagator group are
+   * available separately through ProfileTracer.
+   *
+   * \ingroup TaskTrace
+   */
+  class GECODE_SEARCH_EXPORT DistributionSearchTracer : public SearchTracer {
+  protected:
+    /// Depth of each node, per worker
+    std::vector<std::vector<unsigned int> > nd;
+    /// Number of branch nodes per depth
+    std::vector<unsigned long long int> n_branch;
+    /// Number of failed nodes per depth
+    std::vector<unsigned long long int> n_fail;
+    /// Number of solution nodes per depth
+    std::vector<unsigned long long int> n_solution;
+    /// Record a node in histogram \a h at depth \a d
+    static void record(std::vector<unsigned long long int>& h,
+                       unsigned int d);
+  public:
+    /// Initialize
+    DistributionSearchTracer(void);
+    /// The search engine initializes
+    virtual void init(void);
+    /// The engine with id \a eid goes to a next round (restart or next iteration in LDS)
+    virtual void round(unsigned int eid);
+    /// The engine skips an edge
+    virtual void skip(const EdgeInfo& ei);
+    /// The engine creates a new node with information \a ei and \a ni
+    virtual void node(const EdgeInfo& ei, const NodeInfo& ni);
+    /// All workers are done
+    virtual void done(void);
+    /// Return number of depths with recorded nodes
+    unsigned int depths(void) const;
+    /// Return number of branch nodes at depth \a d
+    unsigned long long int branch(unsigned int d) const;
+    /// Return number of failed nodes at depth \a d
+    unsigned long long int fail(unsigned int d) const;
+    /// Return number of solution nodes at depth \a d
+    unsigned long long int solution(unsigned int d) const;
+    /// Write histograms to \a os (one line per depth)
+    void dump(std::ostream& os) const;
+    /// Discard all collected information
+    void reset(void);
+  };
+
 }
 
 #include <gecode/search/tracer.hpp>
@@ -467,6 +588,17 @@ namespace Gecode { namespace Search {
 
   /**
    * \brief Base class for cutoff generators for restart-based meta engine
+   *
+   * Cutoff generators are user-extensible (subclass and yield any
+   * sequence), but deliberately feedback-free: a cutoff is consumed
+   * when a restart begins, before the behavior it would react to
+   * exists. Behavioral restart triggers compose from the pieces
+   * that do see behavior - the script's master() hook observes the
+   * restart statistics and can adapt state for the next round, and
+   * a monitor watching a search tracer (failure-depth distribution)
+   * can force an early restart through a stop object on the engine,
+   * then continue it. Folding that loop into the cutoff would hide
+   * a monitor thread inside a sequence generator.
    * \ingroup TaskModelSearch
    */
   class GECODE_SEARCH_EXPORT Cutoff : public HeapAllocated {
@@ -749,6 +881,8 @@ namespace Gecode { namespace Search {
       bool clone;
       /// Number of threads to use
       double threads;
+      /// Whether to pin worker threads to processing units
+      bool pin;
       /// Create a clone after every \a c_d commits (commit distance)
       unsigned int c_d;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
@@ -874,6 +1008,12 @@ namespace Gecode { namespace Search {
     Support::Timer t;
     /// Current limit in milliseconds
     unsigned long int l;
+    /// Number of stop checks to skip before consulting the clock again
+    unsigned int c;
+    /// Elapsed time at the most recent clock reading (in milliseconds)
+    double e_l;
+    /// Number of checks between the two most recent clock readings
+    unsigned int n_l;
   public:
     /// Stop if search exceeds \a l milliseconds (from creation of this object)
     TimeStop(unsigned long int l);
@@ -887,6 +1027,33 @@ namespace Gecode { namespace Search {
     virtual bool stop(const Statistics& s, const Options& o);
   };
 
+  /**
+   * \brief %Stop-object signalled from outside the engine
+   *
+   * Stops search as soon as signal() has been called. The signal may
+   * come from another thread, typically one that coordinates several
+   * solver processes: in a distributed setup, each process drives its
+   * engine through the usual next()/constrain() loop to exchange
+   * incumbent bounds, and a communication thread calls signal() when a
+   * remote process reports termination.
+   *
+   * \ingroup TaskModelSearchStop
+   */
+  class GECODE_SEARCH_EXPORT ExternalStop : public Stop {
+  protected:
+    /// Whether stop has been signalled
+    std::atomic<bool> s;
+  public:
+    /// Initialize (not yet signalled)
+    ExternalStop(void);
+    /// Signal that search must stop (thread-safe)
+    void signal(void);
+    /// Reset to not signalled
+    void reset(void);
+    /// Return true if stop has been signalled
+    virtual bool stop(const Statistics& s, const Options& o);
+  };
+
 }}
 
 #include <gecode/search/stop.hpp>
@@ -910,6 +1077,10 @@ namespace Gecode { namespace Search {
     virtual void reset(Space* s);
     /// Return no-goods (the no-goods are empty)
     virtual NoGoods& nogoods(void);
+    /// Write a checkpoint of the search state to \a os (raises exception)
+    virtual void checkpoint(std::ostream& os) const;
+    /// Resume from checkpoint in \a is, restarting at a fresh root \a s (raises exception)
+    virtual void resume(Space* s, std::istream& is);
     /// Destructor
     virtual ~Engine(void);
   };
@@ -939,6 +1110,33 @@ namespace Gecode { namespace Search {
     virtual Statistics statistics(void) const;
     /// Check whether engine has been stopped
     virtual bool stopped(void) const;
+    /**
+     * \brief Write a checkpoint of the search state to \a os
+     *
+     * The checkpoint records the current path in the search tree
+     * (choices and alternatives) together with the search statistics,
+     * but not the root space itself: resume() must be given a fresh
+     * root created by posting the very same model again.
+     *
+     * Raises an exception of type Search::NoCheckpoint if the engine
+     * does not support checkpoints.
+     */
+    virtual void checkpoint(std::ostream& os) const;
+    /**
+     * \brief Resume from checkpoint in \a is, restarting at root \a s
+     *
+     * The space \a s must have been created by posting the very same
+     * model that was being solved when the checkpoint was taken. The
+     * engine takes ownership of \a s (as reset() does), regardless
+     * of whether resuming succeeds. For best solution search, the
+     * incumbent is not part of a checkpoint: re-impose it by passing
+     * the best solution found so far to constrain() after resuming.
+     *
+     * Raises an exception of type Search::NoCheckpoint if the engine
+     * does not support checkpoints and of type
+     * Search::InvalidCheckpoint if the checkpoint data is corrupted.
+     */
+    virtual void resume(T* s, std::istream& is);
     /// Destructor
     virtual ~Base(void);
   private:
@@ -1064,6 +1262,16 @@ namespace Gecode {
    * to the space \a c currently being explored, the engine
    * executes \c c.constrain(t) where \a t is the so-far
    * best solution.
+   *
+   * Since constrain() is user-defined, the engine is not limited to
+   * single-objective search: for multi-objective problems, post in
+   * constrain() that the space must not be dominated by \a t (an
+   * improvement in at least one objective), and the stream of
+   * solutions forms a Pareto front in a single exploration - each
+   * solution is non-dominated by all earlier ones, and a final
+   * filtering pass over the reported solutions removes those that a
+   * later solution dominates. This replaces epsilon-constraint loops
+   * that re-explore shared subtrees once per weight vector.
    * \ingroup TaskModelSearch
    */
   template<class T>
@@ -1071,6 +1279,17 @@ namespace Gecode {
   public:
     /// Initialize engine for space \a s and options \a o
     BAB(T* s, const Search::Options& o=Search::Options::def);
+    /**
+     * \brief Warm-start search with a previously found solution \a w
+     *
+     * Constrains the engine as if \a w had just been found as a
+     * solution, so exploration immediately proves against its
+     * objective value instead of rediscovering it. Typical use is
+     * re-solving a near-identical instance seeded with the last
+     * run's best solution. Must be called before the first call to
+     * next().
+     */
+    void warm(const T& w);
     /// Whether engine does best solution search
     static const bool best = true;
   };
@@ -1136,6 +1355,14 @@ namespace Gecode {
    * The engine uses the Cutoff sequence supplied in the options \a o to
    * periodically restart the search of engine \a E.
    *
+   * Restarts do not recompute propagator-internal state from
+   * scratch: the engine keeps a master space at the root fixpoint
+   * and every restart clones it, and cloning copies each
+   * propagator's internal state (table supports, task trees,
+   * matchings) along with it. Only state invalidated by what the
+   * master() hook posts after a restart (such as no-goods) is
+   * re-derived, necessarily.
+   *
    * The class \a T can implement member functions
    * \code virtual bool master(const MetaInfo& mi) \endcode
    * and
@@ -1230,6 +1457,34 @@ namespace Gecode {
    * When the assets are created, these functions are executed.
    * For more details, consult "Modeling and Programming with Gecode".
    *
+   * Threads should be budgeted so that assets times threads per
+   * asset does not exceed the cores: each asset's engine uses the
+   * thread count of its own options (set them in the engine
+   * builders), so the budget is explicit rather than enforced. For
+   * more assets than cores, cooperative time-slicing exists as the
+   * sequential portfolio, which preempts assets on failure slices
+   * with their state frozen in place - preempting a running
+   * parallel engine from outside is not possible, as its workers
+   * only yield at engine commands.
+   *
+   * Asset roots are cloned sequentially at engine construction by
+   * necessity: cloning traverses and temporarily rewires the master
+   * space (forwarding pointers live inside the master's variable
+   * implementations), so two concurrent clones of one space would
+   * race on the master itself. For many assets over a huge root,
+   * amortize instead: hand the engine a root that is already at a
+   * fixpoint (flushed propagator caches clone smaller), or build a
+   * binary asset tree where each level clones from the previous
+   * level's clones in parallel processes.
+   *
+   * The engine-builder constructor makes the portfolio a racing
+   * harness for restart policies: pass one rbs() builder per cutoff
+   * strategy (luby, geometric, constant, ...) and the assets race,
+   * with best solution search additionally exchanging incumbent
+   * bounds between them. Whichever policy fits the instance
+   * finishes (or drives the bound) first; mis-picked cutoffs cost a
+   * core, not the run.
+   *
    * \ingroup TaskModelSearch
    */
   template<class T, template<class> class E = DFS>
@@ -1275,6 +1530,8 @@ namespace Gecode {
 
 #include <gecode/search/pbs.hpp>
 
+#include <gecode/search/prefetch.hpp>
+
 #endif
 
 // STATISTICS: search-other
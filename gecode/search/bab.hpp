@@ -72,6 +72,12 @@ namespace Gecode {
   BAB<T>::BAB(T* s, const Search::Options& o)
     : Search::Base<T>(Search::babengine(s,o)) {}
 
+  template<class T>
+  inline void
+  BAB<T>::warm(const T& w) {
+    this->e->constrain(w);
+  }
+
   template<class T>
   inline T*
   bab(T* s, const Search::Options& o) {
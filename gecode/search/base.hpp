@@ -57,6 +57,16 @@ namespace Gecode { namespace Search {
     return e->stopped();
   }
   template<class T>
+  forceinline void
+  Base<T>::checkpoint(std::ostream& os) const {
+    e->checkpoint(os);
+  }
+  template<class T>
+  forceinline void
+  Base<T>::resume(T* s, std::istream& is) {
+    e->resume(s,is);
+  }
+  template<class T>
   forceinline
   Base<T>::~Base(void) {
     delete e;
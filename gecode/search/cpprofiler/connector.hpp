@@ -105,10 +105,17 @@ namespace Gecode { namespace CPProfiler {
     
     int sockfd;
     bool _connected;
+
+    /// Batch of framed messages not yet written to the socket
+    std::vector<char> batch;
+    /// Flush the batch once it grows beyond this size
+    static const size_t batch_limit = 64 * 1024;
     
     static int sendall(int s, const char* buf, int* len);
-    void sendOverSocket(void);
+    void sendOverSocket(bool flush_now = false);
     void sendRawMsg(const std::vector<char>& buf);
+    /// Write out all batched messages
+    void flush(void);
   public:    
     Connector(unsigned int port);
     
@@ -256,12 +263,28 @@ namespace Gecode { namespace CPProfiler {
   }
     
   inline void
-  Connector::sendOverSocket(void) {
+  Connector::flush(void) {
+    if (!_connected || batch.empty()) return;
+    int len = static_cast<int>(batch.size());
+    sendall(sockfd, batch.data(), &len);
+    batch.clear();
+  }
+
+  inline void
+  Connector::sendOverSocket(bool flush_now) {
     if (!_connected) return;
       
     std::vector<char> buf = marshalling.serialize();
-      
-    sendRawMsg(buf);
+
+    // Append the framed message to the batch, a node message alone
+    // is not worth a system call
+    uint32_t bufSize = static_cast<uint32_t>(buf.size());
+    const char* size_bytes = reinterpret_cast<const char*>(&bufSize);
+    batch.insert(batch.end(), size_bytes, size_bytes + sizeof(uint32_t));
+    batch.insert(batch.end(), buf.begin(), buf.end());
+
+    if (flush_now || (batch.size() >= batch_limit))
+      flush();
   }
     
   inline void
@@ -350,7 +373,7 @@ namespace Gecode { namespace CPProfiler {
     }
     
     marshalling.makeStart(info);
-    sendOverSocket();
+    sendOverSocket(true);
   }
 
   inline void
@@ -366,17 +389,18 @@ namespace Gecode { namespace CPProfiler {
     }
     
     marshalling.makeRestart(info);
-    sendOverSocket();
+    sendOverSocket(true);
   }
   
   inline void
   Connector::done() {
     marshalling.makeDone();
-    sendOverSocket();
+    sendOverSocket(true);
   }
   
   inline void
   Connector::disconnect() {
+    flush();
 #ifdef WIN32
     closesocket(sockfd);
 #else
@@ -48,6 +48,16 @@ namespace Gecode { namespace Search {
   Engine::nogoods(void) {
     return NoGoods::eng;
   }
+  void
+  Engine::checkpoint(std::ostream& os) const {
+    (void) os;
+    throw NoCheckpoint("Engine::checkpoint");
+  }
+  void
+  Engine::resume(Space* s, std::istream& is) {
+    (void) s; (void) is;
+    throw NoCheckpoint("Engine::resume");
+  }
 
 }}
 
@@ -48,6 +48,12 @@ namespace Gecode { namespace Search {
   NoBest::NoBest(const char* l)
     : Exception(l,"Best solution search is not supported") {}
 
+  NoCheckpoint::NoCheckpoint(const char* l)
+    : Exception(l,"Checkpoint and resume are not supported") {}
+
+  InvalidCheckpoint::InvalidCheckpoint(const char* l)
+    : Exception(l,"Checkpoint data is invalid") {}
+
 }}
 
 // STATISTICS: search-other
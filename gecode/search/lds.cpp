@@ -38,15 +38,33 @@
 #include <gecode/search/support.hh>
 
 #include <gecode/search/seq/lds.hh>
+#ifdef GECODE_HAS_THREADS
+#include <gecode/search/par/lds.hh>
+#endif
 
 namespace Gecode { namespace Search {
 
   Engine*
   ldsengine(Space* s, const Options& o) {
+#ifdef GECODE_HAS_THREADS
+    Options to = o.expand();
+    if (to.threads == 1.0) {
+      if (to.tracer)
+        return new Seq::LDS<EdgeTraceRecorder>(s,to);
+      else
+        return new Seq::LDS<NoTraceRecorder>(s,to);
+    } else {
+      if (to.tracer)
+        return new Par::LDS<EdgeTraceRecorder>(s,to);
+      else
+        return new Par::LDS<NoTraceRecorder>(s,to);
+    }
+#else
     if (o.tracer)
       return new Seq::LDS<EdgeTraceRecorder>(s,o);
     else
       return new Seq::LDS<NoTraceRecorder>(s,o);
+#endif
   }
 
 }}
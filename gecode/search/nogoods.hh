@@ -61,7 +61,16 @@ namespace Gecode { namespace Search {
     virtual NGL* copy(Space& home);
   };
 
-  /// No-good propagator
+  /**
+   * \brief No-good propagator
+   *
+   * A single propagator owns all no-goods extracted from a path:
+   * they are stored as one shared literal tree (common prefixes are
+   * shared) and the propagator subscribes lazily only to the
+   * leaf-literals and the next subtree root, in the style of watched
+   * literals. Raising the no-good depth limit therefore grows this
+   * one propagator's literal tree, not the number of propagators.
+   */
   class GECODE_SEARCH_EXPORT NoGoodsProp : public Propagator {
   protected:
     /// Root of no-good literal tree
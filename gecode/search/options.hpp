@@ -36,7 +36,7 @@ namespace Gecode { namespace Search {
   forceinline
   Options::Options(void)
     : clone(Config::clone),
-      threads(Config::threads),
+      threads(Config::threads), pin(Config::pin),
       c_d(Config::c_d), a_d(Config::a_d),
       d_l(Config::d_l),
       assets(0), slice(Config::slice), nogoods_limit(0),
@@ -38,7 +38,20 @@
 
 namespace Gecode { namespace Search { namespace Par {
 
-  /// %Parallel branch-and-bound engine
+  /**
+   * \brief %Parallel branch-and-bound engine
+   *
+   * Incumbent handling is two-level: the engine's best solution is
+   * updated under the search mutex only when a worker actually
+   * reports a solution, and each worker keeps its own best clone
+   * (updated through better() during the same announcement), so
+   * exploration reads the bound without any shared access. An
+   * RCU/epoch scheme was evaluated for the announcement itself and
+   * rejected: the critical section runs once per improving solution
+   * - not per node - and contains a constrain/status check that
+   * must be ordered against concurrent reports anyway to keep the
+   * incumbent monotone.
+   */
   template<class Tracer>
   class BAB : public Engine<Tracer> {
   protected:
@@ -71,6 +84,8 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::cur;
       using Engine<Tracer>::Worker::d;
       using Engine<Tracer>::Worker::idle;
+      using Engine<Tracer>::Worker::s_stolen;
+      using Engine<Tracer>::Worker::s_wid;
       using Engine<Tracer>::Worker::node;
       using Engine<Tracer>::Worker::fail;
       using Engine<Tracer>::Worker::start;
@@ -58,6 +58,7 @@ namespace Gecode { namespace Search { namespace Par {
     d = 0;
     mark = 0;
     idle = false;
+    s_stolen = false;
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
       delete s;
       cur = NULL;
@@ -149,18 +150,54 @@ namespace Gecode { namespace Search { namespace Par {
     // Try to find new work (even if there is none)
     for (unsigned int i=0U; i<engine().workers(); i++) {
       unsigned long int r_d = 0ul;
+      Archive ea;
+      unsigned int a_fst, a_lst;
+      bool multi = false;
       typename Engine<Tracer>::Worker* wi = engine().worker(i);
-      if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
-        // Reset this guy
+      if (Space* s = wi->steal(r_d,wi->tracer,tracer,ea,a_fst,a_lst,multi)) {
         m.acquire();
+        if (best != NULL)
+          s->constrain(*best);
+        if (multi) {
+          /*
+           * The stolen space is not stable after the recomputation
+           * commits (and the constraint just added): bring it to a
+           * fixpoint before the choice is unarchived and the clone
+           * for the path edge is taken. If it fails, all stolen
+           * alternatives are failed and the steal is abandoned.
+           */
+          if (s->status(*this) == SS_FAILED) {
+            fail++;
+            delete s;
+            m.release();
+            // The steal had marked this worker as busy again
+            engine().idle();
+            continue;
+          }
+        }
+        // Reset this guy
         idle = false;
         // Not idle but also does not have the root of the tree
         path.ngdl(0);
         d = 0;
-        cur = s;
         mark = 0;
-        if (best != NULL)
-          cur->constrain(*best);
+        s_stolen = false;
+        if (multi) {
+          // Several alternatives were stolen: put them on the path.
+          // The edge's parent is the victim's node, carried over from
+          // the edge information the steal has prepared.
+          unsigned int nid = 0U;
+          if (tracer && *tracer.ei()) {
+            s_stolen = true;
+            s_wid = tracer.ei()->wid();
+            nid = tracer.ei()->nid();
+            tracer.invalidate();
+          }
+          const Choice* ch = s->choice(ea);
+          path.push(*this,ch,a_fst,a_lst,s->clone(),nid);
+          s->commit(*ch,a_fst);
+        }
+        cur = s;
         Statistics t = *this;
         Search::Worker::reset(r_d);
         (*this) += t;
@@ -223,6 +260,14 @@ namespace Gecode { namespace Search { namespace Par {
      *   betterness is guaranteed.
      *
      */
+    // Pin worker to a processing unit, so that the memory it first
+    // touches (in particular clones) stays on its NUMA node
+    if (engine().opt().pin)
+      for (unsigned int i=0U; i<engine().workers(); i++)
+        if (this == engine().worker(i)) {
+          Support::Thread::pin(i);
+          break;
+        }
     // Peform initial delay, if not first worker
     if (this != engine().worker(0))
       Support::Thread::sleep(Config::initial_delay);
@@ -268,7 +313,12 @@ namespace Gecode { namespace Search { namespace Par {
               if (tracer) {
                 if (path.entries() > 0) {
                   typename Path<Tracer>::Edge& top = path.top();
-                  ei.init(tracer.wid(), top.nid(), top.truealt(),
+                  // The bottom edge of a stolen path references the
+                  // victim's worker and node
+                  unsigned int pw =
+                    ((path.entries() == 1) && s_stolen) ?
+                    s_wid : tracer.wid();
+                  ei.init(pw, top.nid(), top.truealt(),
                           *cur, *top.choice());
                 } else if (*tracer.ei()) {
                   ei = *tracer.ei();
@@ -316,6 +366,12 @@ namespace Gecode { namespace Search { namespace Par {
                     c = NULL;
                     d++;
                   }
+                  // A new bottom edge belongs to this worker again
+                  // (also when a stolen bottom edge is replaced by
+                  // the last-alternative reuse in push)
+                  if ((path.entries() == 0) ||
+                      ((path.entries() == 1) && path.top().lao()))
+                    s_stolen = false;
                   const Choice* ch = path.push(*this,cur,c,nid);
                   if (tracer) {
                     SearchTracer::NodeInfo ni(SearchTracer::NodeType::BRANCH,
@@ -71,6 +71,8 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::cur;
       using Engine<Tracer>::Worker::d;
       using Engine<Tracer>::Worker::idle;
+      using Engine<Tracer>::Worker::s_stolen;
+      using Engine<Tracer>::Worker::s_wid;
       using Engine<Tracer>::Worker::node;
       using Engine<Tracer>::Worker::fail;
       using Engine<Tracer>::Worker::start;
@@ -63,11 +63,19 @@ namespace Gecode { namespace Search { namespace Par {
       unsigned int d;
       /// Whether the worker is idle
       bool idle;
+      /// Whether the bottom path edge was stolen (for tracing)
+      bool s_stolen;
+      /// Worker id of the victim the bottom edge was stolen from
+      unsigned int s_wid;
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, Engine& e);
       /// Hand over some work (NULL if no work available)
-      Space* steal(unsigned long int& d, Tracer& myt, Tracer& ot);
+      Space* steal(unsigned long int& d, Tracer& myt, Tracer& ot,
+                   Archive& ea, unsigned int& a_fst, unsigned int& a_lst,
+                   bool& multi);
+      /// Return worker id of the reporter of the bottom edge's node
+      unsigned int bottom_wid(void) const;
       /// Return statistics
       Statistics statistics(void);
       /// Provide access to engine
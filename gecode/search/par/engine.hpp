@@ -95,7 +95,7 @@ namespace Gecode { namespace Search { namespace Par {
   Engine<Tracer>::Worker::Worker(Space* s, Engine& e)
     : tracer(e.opt().tracer), _engine(e),
       path(s == NULL ? 0 : e.opt().nogoods_limit), d(0),
-      idle(false) {
+      idle(false), s_stolen(false), s_wid(0U) {
     tracer.worker();
     if (s != NULL) {
       if (s->status(*this) == SS_FAILED) {
@@ -126,6 +126,13 @@ namespace Gecode { namespace Search { namespace Par {
   }
 
 
+  template<class Tracer>
+  forceinline unsigned int
+  Engine<Tracer>::Worker::bottom_wid(void) const {
+    return s_stolen ? s_wid : tracer.wid();
+  }
+
+
   /*
    * Statistics
    */
@@ -263,21 +270,38 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline Space*
   Engine<Tracer>::Worker::steal(unsigned long int& d, 
-                                Tracer& myt, Tracer& ot) {
+                                Tracer& myt, Tracer& ot,
+                                Archive& ea, unsigned int& a_fst,
+                                unsigned int& a_lst, bool& multi) {
     /*
      * Make a quick check whether the worker might have work
      *
-     * If that is not true any longer, the worker will be asked
-     * again eventually.
+     * The check is lock-free: if it is not true any longer, the
+     * worker will be asked again eventually.
      */
     if (!path.steal())
       return NULL;
-    m.acquire();
-    Space* s = path.steal(*this,d,myt,ot);
-    m.release();
-    // Tell that there will be one more busy worker
+    /*
+     * Do not block on the victim's mutex: if the victim is busy
+     * exploring or another thief got here first, move on to the
+     * next worker rather than serializing all thieves.
+     */
+    if (!m.tryacquire())
+      return NULL;
+    Space* s = path.steal(*this,d,myt,ot,bottom_wid(),
+                          ea,a_fst,a_lst,multi);
+    /*
+     * Tell that there will be one more busy worker while still
+     * holding the victim's mutex: as long as the victim's path held
+     * work, the victim cannot have passed its own idle transition
+     * (which happens under its mutex with an empty path), so the
+     * increment always sees a non-zero busy count. Counting after
+     * the release opens a window in which all workers can go idle
+     * and the engine terminates although work has been handed out.
+     */
     if (s != NULL)
       engine().busy();
+    m.release();
     return s;
   }
 
@@ -0,0 +1,157 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_PAR_LDS_HH__
+#define __GECODE_SEARCH_PAR_LDS_HH__
+
+#include <gecode/search/par/engine.hh>
+#include <gecode/search/seq/lds.hh>
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /**
+   * \brief %Parallel limited discrepancy search engine
+   *
+   * Distributes discrepancy probes across workers: each worker claims
+   * the next discrepancy and runs a sequential probe on a clone of
+   * the root. As probes for different discrepancies visit disjoint
+   * leaves, workers never duplicate work. Solutions are reported as
+   * found and hence not necessarily in order of increasing
+   * discrepancy (as for all parallel engines, exploration order is
+   * not deterministic).
+   */
+  template<class Tracer>
+  class LDS : public Engine<Tracer> {
+  protected:
+    using Engine<Tracer>::idle;
+    using Engine<Tracer>::busy;
+    using Engine<Tracer>::stop;
+    using Engine<Tracer>::block;
+    using Engine<Tracer>::e_search;
+    using Engine<Tracer>::e_reset_ack_start;
+    using Engine<Tracer>::e_reset_ack_stop;
+    using Engine<Tracer>::n_busy;
+    using Engine<Tracer>::m_search;
+    using Engine<Tracer>::m_wait_reset;
+    using Engine<Tracer>::opt;
+    using Engine<Tracer>::release;
+    using Engine<Tracer>::signal;
+    using Engine<Tracer>::solutions;
+    using Engine<Tracer>::terminate;
+    using Engine<Tracer>::workers;
+    using Engine<Tracer>::C_WAIT;
+    using Engine<Tracer>::C_RESET;
+    using Engine<Tracer>::C_TERMINATE;
+    using Engine<Tracer>::C_WORK;
+    /// %Stop object that additionally yields on engine commands
+    class CmdStop : public Search::Stop {
+    protected:
+      /// The engine to watch
+      Engine<Tracer>& e;
+      /// The user-provided stop object (possibly NULL)
+      Search::Stop* so;
+    public:
+      /// Initialize for engine \a e and stop object \a so
+      CmdStop(Engine<Tracer>& e, Search::Stop* so);
+      /// Return true if engine command or stop object demand stopping
+      virtual bool stop(const Statistics& s, const Options& o);
+    };
+    /// %Parallel limited discrepancy search worker
+    class Worker : public Engine<Tracer>::Worker {
+    public:
+      using Engine<Tracer>::Worker::_engine;
+      using Engine<Tracer>::Worker::m;
+      using Engine<Tracer>::Worker::idle;
+    protected:
+      /// The probe for the currently claimed discrepancy
+      Seq::Probe<Tracer> probe;
+      /// Whether the worker currently owns a probe
+      bool has_probe;
+      /// Probe statistics snapshot (updated at probe hand-back points)
+      Statistics sstat;
+    public:
+      /// Initialize for engine \a e
+      Worker(LDS& e);
+      /// Provide access to engine
+      LDS& engine(void) const;
+      /// Start execution of worker
+      virtual void run(void);
+      /// Reset worker (drops the current probe)
+      void reset(void);
+      /// Return statistics
+      Statistics statistics(void);
+    };
+    /// Array of worker references
+    Worker** _worker;
+    /// Root space probes are cloned from (possibly NULL)
+    Space* root;
+    /// Mutex protecting discrepancy hand-out
+    Support::Mutex m_probe;
+    /// Next discrepancy to be probed
+    unsigned int next_d;
+    /// Whether some probe has explored the tree exhaustively
+    bool exhausted;
+  public:
+    /// Provide access to worker \a i
+    Worker* worker(unsigned int i) const;
+
+    /// \name Search control
+    //@{
+    /// Report solution \a s
+    void solution(Space* s);
+    /// Claim next discrepancy \a d with root clone \a s (false if none left)
+    bool claim(unsigned int& d, Space*& s);
+    /// Report that a probe has explored the tree exhaustively
+    void exhaust(void);
+    //@}
+
+    /// \name Engine interface
+    //@{
+    /// Initialize for space \a s with options \a o
+    LDS(Space* s, const Options& o);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Reset engine to restart at space \a s
+    virtual void reset(Space* s);
+    /// Destructor
+    virtual ~LDS(void);
+    //@}
+  };
+
+}}}
+
+#include <gecode/search/par/lds.hpp>
+
+#endif
+
+// STATISTICS: search-par
@@ -0,0 +1,313 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /*
+   * Basic access routines
+   */
+  template<class Tracer>
+  forceinline LDS<Tracer>&
+  LDS<Tracer>::Worker::engine(void) const {
+    return static_cast<LDS<Tracer>&>(_engine);
+  }
+  template<class Tracer>
+  forceinline typename LDS<Tracer>::Worker*
+  LDS<Tracer>::worker(unsigned int i) const {
+    return _worker[i];
+  }
+
+
+  /*
+   * Stop object yielding on engine commands
+   */
+  template<class Tracer>
+  forceinline
+  LDS<Tracer>::CmdStop::CmdStop(Engine<Tracer>& e0, Search::Stop* so0)
+    : e(e0), so(so0) {}
+  template<class Tracer>
+  bool
+  LDS<Tracer>::CmdStop::stop(const Statistics& s, const Options& o) {
+    return (e.cmd() != Engine<Tracer>::C_WORK) ||
+      ((so != NULL) && so->stop(s,o));
+  }
+
+
+  /*
+   * Engine: initialization
+   */
+  template<class Tracer>
+  forceinline
+  LDS<Tracer>::Worker::Worker(LDS& e)
+    : Engine<Tracer>::Worker(NULL,e), probe(e.opt()), has_probe(false) {
+    probe.init(NULL);
+  }
+
+  template<class Tracer>
+  forceinline
+  LDS<Tracer>::LDS(Space* s, const Options& o)
+    : Engine<Tracer>(o), root(NULL), next_d(0U), exhausted(false) {
+    WrapTraceRecorder::engine(o.tracer, SearchTracer::EngineType::LDS,
+                              workers());
+    // Create workers
+    _worker = static_cast<Worker**>
+      (heap.ralloc(workers() * sizeof(Worker*)));
+    for (unsigned int i=0U; i<workers(); i++)
+      _worker[i] = new Worker(*this);
+    // Set up the root space all probes are cloned from
+    if (s != NULL) {
+      if (s->status(*_worker[0]) == SS_FAILED) {
+        _worker[0]->fail++;
+        if (!o.clone)
+          delete s;
+      } else {
+        root = snapshot(s,o);
+      }
+    }
+    // Block all workers
+    block();
+    // Create and start threads
+    for (unsigned int i=0U; i<workers(); i++)
+      Support::Thread::run(_worker[i]);
+  }
+
+
+  /*
+   * Engine: search control
+   */
+  template<class Tracer>
+  forceinline void
+  LDS<Tracer>::solution(Space* s) {
+    m_search.acquire();
+    bool bs = signal();
+    solutions.push(s);
+    if (bs)
+      e_search.signal();
+    m_search.release();
+  }
+
+  template<class Tracer>
+  forceinline bool
+  LDS<Tracer>::claim(unsigned int& d, Space*& s) {
+    m_probe.acquire();
+    if (exhausted || (root == NULL) || (next_d > opt().d_l)) {
+      m_probe.release();
+      return false;
+    }
+    d = next_d++;
+    // Cloning is serialized as the root is shared among workers
+    s = root->clone();
+    m_probe.release();
+    return true;
+  }
+
+  template<class Tracer>
+  forceinline void
+  LDS<Tracer>::exhaust(void) {
+    m_probe.acquire();
+    exhausted = true;
+    m_probe.release();
+  }
+
+
+  /*
+   * Worker: running a probe
+   */
+  template<class Tracer>
+  void
+  LDS<Tracer>::Worker::run(void) {
+    // Options with a stop object that also yields on engine commands
+    CmdStop cs(_engine,engine().opt().stop);
+    Options wopt(engine().opt());
+    wopt.stop = &cs;
+    // Peform initial delay, if not first worker
+    if (this != engine().worker(0))
+      Support::Thread::sleep(Config::initial_delay);
+    // Okay, we are in business, start working
+    while (true) {
+      switch (engine().cmd()) {
+      case C_WAIT:
+        // Wait
+        engine().wait();
+        break;
+      case C_TERMINATE:
+        // Acknowledge termination request
+        engine().ack_terminate();
+        // Wait until termination can proceed
+        engine().wait_terminate();
+        // Thread will be terminated by returning from run
+        return;
+      case C_RESET:
+        // Acknowledge reset request
+        engine().ack_reset_start();
+        // Wait until reset has been performed
+        engine().wait_reset();
+        // Acknowledge that reset cycle is over
+        engine().ack_reset_stop();
+        break;
+      case C_WORK:
+        if (!has_probe) {
+          unsigned int d; Space* s;
+          if (engine().claim(d,s)) {
+            m.acquire();
+            if (idle) {
+              idle = false;
+              m.release();
+              engine().busy();
+            } else {
+              m.release();
+            }
+            probe.reset(s,d);
+            has_probe = true;
+          } else if (!idle) {
+            m.acquire();
+            idle = true;
+            m.release();
+            // Report that worker is idle
+            engine().idle();
+          }
+        } else {
+          Space* s = probe.next(wopt);
+          /*
+           * The probe is idle between steps on this thread: refresh
+           * the statistics snapshot that concurrent statistics()
+           * calls read under the worker mutex (the probe itself is
+           * never read concurrently).
+           */
+          m.acquire();
+          sstat = probe.statistics();
+          m.release();
+          if (s != NULL) {
+            engine().solution(s);
+          } else if (probe.completed()) {
+            // The probe is finished for its discrepancy
+            if (probe.done())
+              engine().exhaust();
+            has_probe = false;
+          } else if (engine().cmd() == C_WORK) {
+            // The user-provided stop object has triggered
+            engine().stop();
+          }
+          // Otherwise, an engine command interrupted the probe: the
+          // probe state is kept and exploration resumes later
+        }
+        break;
+      default:
+        GECODE_NEVER;
+      }
+    }
+  }
+
+
+  /*
+   * Statistics
+   */
+  template<class Tracer>
+  forceinline Statistics
+  LDS<Tracer>::Worker::statistics(void) {
+    m.acquire();
+    Statistics s = *this;
+    s += sstat;
+    m.release();
+    return s;
+  }
+
+  template<class Tracer>
+  Statistics
+  LDS<Tracer>::statistics(void) const {
+    Statistics s;
+    for (unsigned int i=0U; i<workers(); i++)
+      s += worker(i)->statistics();
+    return s;
+  }
+
+
+  /*
+   * Perform reset
+   */
+  template<class Tracer>
+  forceinline void
+  LDS<Tracer>::Worker::reset(void) {
+    probe.reset(NULL,0U);
+    has_probe = false;
+    idle = false;
+    sstat = probe.statistics();
+    Search::Worker::reset();
+  }
+
+  template<class Tracer>
+  void
+  LDS<Tracer>::reset(Space* s) {
+    // Grab wait lock for reset
+    m_wait_reset.acquire();
+    // Release workers for reset
+    release(C_RESET);
+    // Wait for reset cycle started
+    e_reset_ack_start.wait();
+    // All workers are marked as busy again
+    n_busy = workers();
+    delete root;
+    root = NULL;
+    next_d = 0U; exhausted = false;
+    for (unsigned int i=0U; i<workers(); i++)
+      worker(i)->reset();
+    if (s != NULL) {
+      if (s->status(*worker(0)) == SS_FAILED) {
+        worker(0)->fail++;
+        delete s;
+      } else {
+        root = s;
+      }
+    }
+    // Block workers again to ensure invariant
+    block();
+    // Release reset lock
+    m_wait_reset.release();
+    // Wait for reset cycle stopped
+    e_reset_ack_stop.wait();
+  }
+
+
+  /*
+   * Termination and deletion
+   */
+  template<class Tracer>
+  LDS<Tracer>::~LDS(void) {
+    terminate();
+    delete root;
+    heap.rfree(_worker);
+  }
+
+}}}
+
+// STATISTICS: search-par
@@ -35,6 +35,7 @@
 #define __GECODE_SEARCH_PAR_PATH_HH__
 
 #include <algorithm>
+#include <atomic>
 
 #include <gecode/search.hh>
 #include <gecode/search/support.hh>
@@ -80,6 +81,9 @@ namespace Gecode { namespace Search { namespace Par {
       Edge(void);
       /// Edge for space \a s with clone \a c (possibly NULL)
       Edge(Space* s, Space* c, unsigned int nid);
+      /// Edge for stolen choice \a c with alternatives \a f to \a l, clone \a sp, and victim node \a nid
+      Edge(const Choice* c, unsigned int f, unsigned int l, Space* sp,
+           unsigned int nid);
 
       /// Return space for edge
       Space* space(void) const;
@@ -101,8 +105,8 @@ namespace Gecode { namespace Search { namespace Par {
       bool work(void) const;
       /// Move to next alternative
       void next(void);
-      /// Steal rightmost alternative and return its number
-      unsigned int steal(void);
+      /// Steal all spare alternatives: return first, set \a l to last
+      unsigned int steal(unsigned int& l);
 
       /// Return node identifier
       unsigned int nid(void) const;
@@ -115,8 +119,8 @@ namespace Gecode { namespace Search { namespace Par {
     Support::DynamicStack<Edge,Heap> ds;
     /// Depth limit for no-good generation
     unsigned int _ngdl;
-    /// Number of edges that have work for stealing
-    unsigned int n_work;
+    /// Number of edges that have work for stealing (read lock-free by thieves)
+    std::atomic<unsigned int> n_work;
   public:
     /// Initialize with no-good depth limit \a l
     Path(unsigned int l);
@@ -126,6 +130,9 @@ namespace Gecode { namespace Search { namespace Par {
     void ngdl(unsigned int l);
     /// Push space \a c (a clone of \a s or NULL)
     const Choice* push(Worker& stat, Space* s, Space* c, unsigned int nid);
+    /// Push stolen edge with choice \a c, alternatives \a f to \a l, clone \a sp, and victim node \a nid
+    void push(Worker& stat, const Choice* c, unsigned int f, unsigned int l,
+              Space* sp, unsigned int nid);
     /// Generate path for next node
     void next(void);
     /// Provide access to topmost edge
@@ -151,9 +158,11 @@ namespace Gecode { namespace Search { namespace Par {
     void reset(unsigned int l);
     /// Make a quick check whether stealing might be feasible
     bool steal(void) const;
-    /// Steal work at depth \a d
+    /// Steal work at depth \a d (choice shipped in \a ea for multiple alternatives, \a b_wid is the reporter of the bottom edge's node)
     Space* steal(Worker& stat, unsigned long int& d,
-                 Tracer& myt, Tracer& ot);
+                 Tracer& myt, Tracer& ot, unsigned int b_wid,
+                 Archive& ea, unsigned int& a_fst, unsigned int& a_lst,
+                 bool& multi);
     /// Post no-goods
     void virtual post(Space& home) const;
   };
@@ -48,6 +48,12 @@ namespace Gecode { namespace Search { namespace Par {
     _alt_max = _choice->alternatives()-1;
   }
 
+  template<class Tracer>
+  forceinline
+  Path<Tracer>::Edge::Edge(const Choice* c, unsigned int f, unsigned int l,
+                           Space* sp, unsigned int nid)
+    : _space(sp), _alt(f), _alt_max(l), _choice(c), _nid(nid) {}
+
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::Edge::space(void) const {
@@ -98,9 +104,11 @@ namespace Gecode { namespace Search { namespace Par {
   }
   template<class Tracer>
   forceinline unsigned int
-  Path<Tracer>::Edge::steal(void) {
+  Path<Tracer>::Edge::steal(unsigned int& l) {
     assert(work());
-    return _alt_max--;
+    l = _alt_max;
+    _alt_max = _alt;
+    return _alt+1;
   }
 
   template<class Tracer>
@@ -149,12 +157,23 @@ namespace Gecode { namespace Search { namespace Par {
     }
     Edge sn(s,c,nid);
     if (sn.work())
-      n_work++;
+      n_work.fetch_add(1U,std::memory_order_relaxed);
     ds.push(sn);
     stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
     return sn.choice();
   }
 
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::push(Worker& stat, const Choice* c, unsigned int f,
+                     unsigned int l, Space* sp, unsigned int nid) {
+    Edge sn(c,f,l,sp,nid);
+    if (sn.work())
+      n_work.fetch_add(1U,std::memory_order_relaxed);
+    ds.push(sn);
+    stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
+  }
+
   template<class Tracer>
   forceinline void
   Path<Tracer>::next(void) {
@@ -165,7 +184,7 @@ namespace Gecode { namespace Search { namespace Par {
         assert(ds.top().work());
         ds.top().next();
         if (!ds.top().work())
-          n_work--;
+          n_work.fetch_sub(1U,std::memory_order_relaxed);
         return;
       }
   }
@@ -219,13 +238,13 @@ namespace Gecode { namespace Search { namespace Par {
           t.skip(ei);
         }
         if (ds.top().work())
-          n_work--;
+          n_work.fetch_sub(1U,std::memory_order_relaxed);
         ds.pop().dispose();
       }
     } else {
       for (int i=l; i<n; i++) {
         if (ds.top().work())
-          n_work--;
+          n_work.fetch_sub(1U,std::memory_order_relaxed);
         ds.pop().dispose();
       }
     }
@@ -235,7 +254,7 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline void
   Path<Tracer>::reset(unsigned int l) {
-    n_work = 0;
+    n_work.store(0U,std::memory_order_relaxed);
     while (!ds.empty())
       ds.pop().dispose();
     _ngdl = l;
@@ -244,13 +263,20 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline bool
   Path<Tracer>::steal(void) const {
-    return n_work > Config::steal_limit;
+    /*
+     * Read lock-free by prospective thieves: the counter is only
+     * a hint, a stale value leads to a futile (or missed) steal
+     * attempt but never to an inconsistent path.
+     */
+    return n_work.load(std::memory_order_relaxed) > Config::steal_limit;
   }
 
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::steal(Worker& stat, unsigned long int& d,
-                      Tracer& myt, Tracer& ot) {
+                      Tracer& myt, Tracer& ot, unsigned int b_wid,
+                      Archive& ea, unsigned int& a_fst, unsigned int& a_lst,
+                      bool& multi) {
     // Find position to steal: leave sufficient work
     int n = ds.entries()-1;
     unsigned int w = 0;
@@ -267,15 +293,34 @@ namespace Gecode { namespace Search { namespace Par {
         // Recompute, if necessary
         for (int i=l; i<n; i++)
           commit(c,i);
-        unsigned int a = ds[n].steal();
-        c->commit(*ds[n].choice(),a);
-        if (!ds[n].work())
-          n_work--;
+        // Steal all spare alternatives of the edge at once
+        unsigned int a = ds[n].steal(a_lst);
+        assert(!ds[n].work());
+        n_work.fetch_sub(1U,std::memory_order_relaxed);
+        if (a == a_lst) {
+          // A single alternative: hand out the committed space
+          c->commit(*ds[n].choice(),a);
+          multi = false;
+        } else {
+          /*
+           * Several alternatives: ship the choice so that the thief
+           * can push its own edge and explore the whole range.
+           */
+          ds[n].choice()->archive(ea);
+          a_fst = a;
+          multi = true;
+        }
         // No no-goods can be extracted above n
         ngdl(std::min(ngdl(),static_cast<unsigned int>(n)));
         d = stat.steal_depth(static_cast<unsigned long int>(n+1));
         if (myt && ot) {
-          ot.ei()->init(myt.wid(),ds[n].nid(), a, *c, *ds[n].choice());
+          /*
+           * The parent of the stolen subtree is the node of edge n,
+           * reported by this worker - except for a stolen bottom
+           * edge, whose node was reported by the original victim.
+           */
+          unsigned int pw = (n == 0) ? b_wid : myt.wid();
+          ot.ei()->init(pw, ds[n].nid(), a, *c, *ds[n].choice());
         }
         return c;
       }
@@ -35,8 +35,13 @@
 
 namespace Gecode { namespace Search { namespace Par {
 
+  ApplyIncumbent::~ApplyIncumbent(void) {}
+
   bool
   PortfolioStop::stop(const Statistics& s, const Options& o) {
+    // Apply a pending incumbent on the slave's own thread
+    if (ai != NULL)
+      ai->apply();
     return *tostop || ((so != NULL) && so->stop(s,o));
   }
 
@@ -38,6 +38,15 @@
 
 namespace Gecode { namespace Search { namespace Par {
 
+  /// Interface for applying pending incumbents on the owning thread
+  class GECODE_SEARCH_EXPORT ApplyIncumbent {
+  public:
+    /// Apply a pending incumbent, if any
+    virtual void apply(void) = 0;
+    /// Destructor
+    virtual ~ApplyIncumbent(void);
+  };
+
   /// Stop object used for controling slaves in a portfolio
   class GECODE_SEARCH_EXPORT PortfolioStop : public Stop {
   private:
@@ -45,11 +54,15 @@ namespace Gecode { namespace Search { namespace Par {
     Stop* so;
     /// Whether search must be stopped
     volatile bool* tostop;
+    /// Pending-incumbent hook consulted at every stop check (possibly NULL)
+    ApplyIncumbent* ai;
   public:
     /// Initialize
     PortfolioStop(Stop* so);
     /// Set pointer to shared \a tostop variable
     void share(volatile bool* ts);
+    /// Set pending-incumbent hook to \a a
+    void pending(ApplyIncumbent* a);
     /// Return true if portfolio engine must be stopped
     virtual bool stop(const Statistics& s, const Options& o);
     /// Signal whether search must be stopped
@@ -64,7 +77,8 @@ namespace Gecode { namespace Search { namespace Par {
 
   /// Runnable slave of a portfolio master
   template<class Collect>
-  class GECODE_SEARCH_EXPORT Slave : public Support::Runnable {
+  class GECODE_SEARCH_EXPORT Slave
+    : public Support::Runnable, public ApplyIncumbent {
   protected:
     /// The master engine
     PBS<Collect>* master;
@@ -72,15 +86,23 @@ namespace Gecode { namespace Search { namespace Par {
     Engine* slave;
     /// Stop object
     Stop* stop;
+    /// Statistics snapshot (updated whenever the slave reports)
+    Statistics stat;
+    /// Pending incumbent, to be applied on this slave's own thread
+    Space* pb;
   public:
     /// Initialize with master \a m, slave \a s, and its stop object \a so
     Slave(PBS<Collect>* m, Engine* s, Stop* so);
-    /// Return statistics of slave
+    /// Update the statistics snapshot (slave must not be inside its engine)
+    void sync(void);
+    /// Return statistics snapshot of slave
     Statistics statistics(void) const;
     /// Check whether slave has been stopped
     bool stopped(void) const;
-    /// Constrain with better solution \a b
-    void constrain(const Space& b);
+    /// Publish incumbent \a b (the master's mutex must be held)
+    void publish(Space* b);
+    /// Apply a pending incumbent on this slave's own thread
+    virtual void apply(void);
     /// Perform one run
     virtual void run(void);
     /// Delete slave
@@ -156,14 +178,20 @@ namespace Gecode { namespace Search { namespace Par {
     Support::Mutex m;
     /// Number of busy slaves
     unsigned int n_busy;
-    /// Signal that number of busy slaves becomes zero
+    /// Whether slaves keep running across calls (cooperative best mode)
+    bool running;
+    /// Signal that a solution is available or all slaves are idle
     Support::Event idle;
     /// Process report from slave, return false if solution was ignored
     bool report(Slave<Collect>* slave, Space* s);
     /**
      * The key invariant of the engine is as follows:
-     *  - n_busy is always zero outside the next() function.
-     *  - that entails, that locking is only needed insided next().
+     *  - for collecting all solutions, n_busy is always zero outside
+     *    the next() function.
+     *  - for best solution search, the engine is cooperative: slaves
+     *    keep running across next() calls (tracked by running),
+     *    incumbents are injected into the other slaves as they are
+     *    reported, and all members are protected by the mutex.
      *  - the slaves 0..n_active-1 still might not have exausted their
      *    search space.
      *  - the slaves n_active..n_slaves-1 have exhausted their search space.
@@ -115,22 +115,34 @@ namespace Gecode { namespace Search { namespace Par {
 
   forceinline
   PortfolioStop::PortfolioStop(Stop* so0)
-    : so(so0), tostop(NULL) {}
+    : so(so0), tostop(NULL), ai(NULL) {}
 
   forceinline void
   PortfolioStop::share(volatile bool* ts) {
     tostop = ts;
   }
 
+  forceinline void
+  PortfolioStop::pending(ApplyIncumbent* a) {
+    ai = a;
+  }
+
 
   template<class Collect>
   forceinline
   Slave<Collect>::Slave(PBS<Collect>* m, Engine* s, Stop* so)
-    : Support::Runnable(false), master(m), slave(s), stop(so) {}
+    : Support::Runnable(false), master(m), slave(s), stop(so), pb(NULL) {
+    sync();
+  }
+  template<class Collect>
+  forceinline void
+  Slave<Collect>::sync(void) {
+    stat = slave->statistics();
+  }
   template<class Collect>
   forceinline Statistics
   Slave<Collect>::statistics(void) const {
-    return slave->statistics();
+    return stat;
   }
   template<class Collect>
   forceinline bool
@@ -139,13 +151,33 @@ namespace Gecode { namespace Search { namespace Par {
   }
   template<class Collect>
   forceinline void
-  Slave<Collect>::constrain(const Space& b) {
-    slave->constrain(b);
+  Slave<Collect>::publish(Space* b) {
+    // The master's mutex is held: replace the not yet applied incumbent
+    delete pb;
+    pb = b;
+  }
+  template<class Collect>
+  void
+  Slave<Collect>::apply(void) {
+    Space* b;
+    master->m.acquire();
+    b = pb; pb = NULL;
+    master->m.release();
+    if (b != NULL) {
+      /*
+       * Executed on the thread that owns the slave engine (from its
+       * stop object or between next() calls), so constraining the
+       * engine does not race with its exploration.
+       */
+      slave->constrain(*b);
+      delete b;
+    }
   }
   template<class Collect>
   Slave<Collect>::~Slave(void) {
     delete slave;
     delete stop;
+    delete pb;
   }
 
 
@@ -156,11 +188,14 @@ namespace Gecode { namespace Search { namespace Par {
                     const Statistics& stat0)
     : stat(stat0), slaves(heap.alloc<Slave<Collect>*>(n)),
       n_slaves(n), n_active(n),
-      slave_stop(false), tostop(false), n_busy(0) {
+      slave_stop(false), tostop(false), n_busy(0), running(false) {
     // Initialize slaves
     for (unsigned int i=0U; i<n_slaves; i++) {
       slaves[i] = new Slave<Collect>(this,engines[i],stops[i]);
       static_cast<PortfolioStop*>(stops[i])->share(&tostop);
+      // Incumbents are applied by the slave itself at its stop checks
+      if (Collect::best)
+        static_cast<PortfolioStop*>(stops[i])->pending(slaves[i]);
     }
   }
 
@@ -171,10 +206,32 @@ namespace Gecode { namespace Search { namespace Par {
     // If b is false the report should be repeated (solution was worse)
     bool b = true;
     m.acquire();
+    /*
+     * The reporting slave is outside its engine right now, so its
+     * statistics snapshot can be refreshed safely; statistics() of
+     * the portfolio only ever reads these snapshots under the mutex.
+     */
+    slave->sync();
     if (s != NULL) {
       b = solutions.add(s,slave);
-      if (b)
+      if (Collect::best) {
+        /*
+         * Cooperative mode: a better incumbent is published to the
+         * other slaves (each applies it on its own thread at the
+         * next stop check) and the master is woken up to report it,
+         * while all slaves keep searching with their improved
+         * bounds.
+         */
+        if (b) {
+          for (unsigned int i=0U; i<n_active; i++)
+            if (slaves[i] != slave)
+              slaves[i]->publish(s->clone());
+          idle.signal();
+        }
+        b = false;
+      } else if (b) {
         tostop = true;
+      }
     } else if (slave->stopped()) {
       if (!tostop)
         slave_stop = true;
@@ -201,6 +258,8 @@ namespace Gecode { namespace Search { namespace Par {
   Slave<Collect>::run(void) {
     Space* s;
     do {
+      // Apply an incumbent published while this slave was not running
+      apply();
       s = slave->next();
     } while (!master->report(this,s));
   }
@@ -209,6 +268,37 @@ namespace Gecode { namespace Search { namespace Par {
   Space*
   PBS<Collect>::next(void) {
     m.acquire();
+    if (Collect::best) {
+      /*
+       * Cooperative best mode: slaves keep running across calls and
+       * exchange incumbents as they are found (see report), the
+       * master only collects improved solutions.
+       */
+      if (!running && (n_active > 0)) {
+        tostop = false;
+        slave_stop = false;
+        n_busy = n_active;
+        running = true;
+        for (unsigned int i=0U; i<n_active; i++)
+          Support::Thread::run(slaves[i]);
+      }
+      while (solutions.empty() && (n_busy > 0)) {
+        m.release();
+        idle.wait();
+        m.acquire();
+      }
+      if (n_busy == 0)
+        running = false;
+      Space* s;
+      if (solutions.empty()) {
+        s = NULL;
+      } else {
+        Slave<Collect>* r;
+        s = solutions.get(r);
+      }
+      m.release();
+      return s;
+    }
     if (solutions.empty()) {
       // Clear all
       tostop = false;
@@ -241,10 +331,6 @@ namespace Gecode { namespace Search { namespace Par {
     } else {
       Slave<Collect>* r;
       s = solutions.get(r);
-      if (Collect::best)
-        for (unsigned int i=0U; i<n_active; i++)
-          if (slaves[i] != r)
-            slaves[i]->constrain(*s);
     }
 
     m.release();
@@ -260,28 +346,44 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Collect>
   Statistics
   PBS<Collect>::statistics(void) const {
-    assert(n_busy == 0);
+    PBS<Collect>& p = const_cast<PBS<Collect>&>(*this);
+    p.m.acquire();
     Statistics s(stat);
     for (unsigned int i=0U; i<n_slaves; i++)
       s += slaves[i]->statistics();
+    p.m.release();
     return s;
   }
 
   template<class Collect>
   void
   PBS<Collect>::constrain(const Space& b) {
-    assert(n_busy == 0);
     if (!Collect::best)
       throw NoBest("PBS::constrain");
+    m.acquire();
     if (solutions.constrain(b)) {
-      // The solution is better
+      // The solution is better: publish to all slaves, each applies
+      // it on its own thread (at once if running, else on next start)
       for (unsigned int i=0U; i<n_active; i++)
-        slaves[i]->constrain(b);
+        slaves[i]->publish(b.clone());
     }
+    m.release();
   }
 
   template<class Collect>
   PBS<Collect>::~PBS(void) {
+    m.acquire();
+    if (running) {
+      // Stop the slaves and wait until they have become idle
+      tostop = true;
+      while (n_busy > 0) {
+        m.release();
+        idle.wait();
+        m.acquire();
+      }
+      running = false;
+    }
+    m.release();
     assert(n_busy == 0);
     heap.free<Slave<Collect>*>(slaves,n_slaves);
   }
@@ -0,0 +1,277 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <functional>
+
+namespace Gecode {
+
+  /**
+   * \brief Prefetching iteration of solutions from a search engine
+   *
+   * Keeps the engine searching ahead on its own thread while the
+   * application consumes solutions, buffering up to a bounded number
+   * of solution clones. Useful when solution consumers are expensive
+   * and would otherwise leave the engine (and its worker threads)
+   * idle between next() calls.
+   *
+   * The destructor has to wait until the engine returns from its
+   * current search step; to cancel a long-running search, use a stop
+   * object (for example Search::ExternalStop).
+   *
+   * If the library is compiled without thread support, next()
+   * degenerates to calling the engine directly.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  class Prefetch : public Support::Runnable {
+  protected:
+    /// The engine solutions are prefetched from
+    Search::Base<T>& e;
+    /// Mutex protecting the solution queue
+    Support::Mutex m;
+    /// Event: queue has become non-empty or engine is done
+    Support::Event nonempty;
+    /// Event: queue has become non-full or iteration was cancelled
+    Support::Event nonfull;
+    /// Event: producer has exited
+    Support::Event exited;
+    /// Queue capacity
+    const unsigned int n;
+    /// Queued solutions (circular buffer)
+    T** q;
+    /// Position of first queued solution
+    unsigned int fst;
+    /// Number of queued solutions
+    unsigned int cnt;
+    /// Whether the engine has no more solutions
+    bool done;
+    /// Whether iteration has been cancelled
+    bool cancel;
+  public:
+    /// Initialize for engine \a e with queue capacity \a n
+    Prefetch(Search::Base<T>& e, unsigned int n=8U);
+    /// Producer loop (do not call directly)
+    virtual void run(void);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    T* next(void);
+    /// Destructor (discards not yet consumed solutions)
+    virtual ~Prefetch(void);
+  };
+
+#ifdef GECODE_HAS_THREADS
+
+  template<class T>
+  Prefetch<T>::Prefetch(Search::Base<T>& e0, unsigned int n0)
+    : Support::Runnable(false), e(e0),
+      n((n0 > 0U) ? n0 : 1U), q(heap.alloc<T*>(n)),
+      fst(0U), cnt(0U), done(false), cancel(false) {
+    Support::Thread::run(this);
+  }
+
+  template<class T>
+  void
+  Prefetch<T>::run(void) {
+    while (true) {
+      T* s = e.next();
+      m.acquire();
+      if (cancel) {
+        m.release();
+        delete s;
+        break;
+      }
+      if (s == NULL) {
+        done = true;
+        nonempty.signal();
+        m.release();
+        break;
+      }
+      bool cancelled = false;
+      while (cnt == n) {
+        m.release();
+        nonfull.wait();
+        m.acquire();
+        if (cancel) {
+          cancelled = true;
+          break;
+        }
+      }
+      if (cancelled) {
+        m.release();
+        delete s;
+        break;
+      }
+      q[(fst + cnt) % n] = s;
+      cnt++;
+      nonempty.signal();
+      m.release();
+    }
+    exited.signal();
+  }
+
+  template<class T>
+  T*
+  Prefetch<T>::next(void) {
+    m.acquire();
+    while ((cnt == 0U) && !done) {
+      m.release();
+      nonempty.wait();
+      m.acquire();
+    }
+    T* s = NULL;
+    if (cnt > 0U) {
+      s = q[fst];
+      fst = (fst + 1U) % n;
+      cnt--;
+      nonfull.signal();
+    }
+    m.release();
+    return s;
+  }
+
+  template<class T>
+  Prefetch<T>::~Prefetch(void) {
+    m.acquire();
+    cancel = true;
+    nonfull.signal();
+    m.release();
+    /*
+     * Always synchronize with producer exit: the signal on exited is
+     * the producer's last access to this object, so waiting for it
+     * unconditionally is what makes freeing the object safe.
+     */
+    exited.wait();
+    for (unsigned int i=0U; i<cnt; i++)
+      delete q[(fst + i) % n];
+    heap.free<T*>(q,n);
+  }
+
+#else
+
+  template<class T>
+  Prefetch<T>::Prefetch(Search::Base<T>& e0, unsigned int n0)
+    : Support::Runnable(false), e(e0),
+      n((n0 > 0U) ? n0 : 1U), q(NULL),
+      fst(0U), cnt(0U), done(false), cancel(false) {}
+
+  template<class T>
+  void
+  Prefetch<T>::run(void) {}
+
+  template<class T>
+  T*
+  Prefetch<T>::next(void) {
+    return e.next();
+  }
+
+  template<class T>
+  Prefetch<T>::~Prefetch(void) {}
+
+#endif
+
+
+  /**
+   * \brief Asynchronous solution callbacks from a search engine
+   *
+   * Runs the engine on a pooled thread and invokes the callback with
+   * each solution as it is found (for best solution search, with
+   * each improving solution); ownership of the solution clone passes
+   * to the callback. After the engine is done (no more solutions, or
+   * stopped), the callback is invoked once with NULL.
+   *
+   * The engine cannot be interrupted from the outside: to cancel,
+   * install a stop object (for example Search::ExternalStop) and
+   * signal it; the destructor waits until the engine has returned.
+   *
+   * If the library is compiled without thread support, the engine is
+   * run synchronously in the constructor.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  class Listen : public Support::Runnable {
+  protected:
+    /// The engine solutions are taken from
+    Search::Base<T>& e;
+    /// The callback invoked for every solution (and once with NULL)
+    std::function<void(T*)> f;
+    /// Event: engine is done (re-latched by wait())
+    Support::Event exited;
+  public:
+    /// Initialize for engine \a e with callback \a f and start listening
+    Listen(Search::Base<T>& e, std::function<void(T*)> f);
+    /// Producer loop (do not call directly)
+    virtual void run(void);
+    /// Wait until the engine has no more solutions or was stopped
+    void wait(void);
+    /// Destructor (waits for the engine)
+    virtual ~Listen(void);
+  };
+
+  template<class T>
+  Listen<T>::Listen(Search::Base<T>& e0, std::function<void(T*)> f0)
+    : Support::Runnable(false), e(e0), f(f0) {
+#ifdef GECODE_HAS_THREADS
+    Support::Thread::run(this);
+#else
+    run();
+#endif
+  }
+
+  template<class T>
+  void
+  Listen<T>::run(void) {
+    while (T* s = e.next())
+      f(s);
+    f(NULL);
+    // Last access to this object: wait()/the destructor block on it
+    exited.signal();
+  }
+
+  template<class T>
+  void
+  Listen<T>::wait(void) {
+    exited.wait();
+    // Re-latch so that waiting again (in particular, the destructor
+    // after an explicit wait) returns immediately
+    exited.signal();
+  }
+
+  template<class T>
+  Listen<T>::~Listen(void) {
+    wait();
+  }
+
+}
+
+// STATISTICS: search-other
@@ -156,6 +156,67 @@ namespace Gecode { namespace Search { namespace Seq {
     return *this;
   }
 
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::checkpoint(std::ostream& os) const {
+    // The incumbent (best) is not part of a checkpoint: re-impose it
+    // through constrain() after resuming
+    os << ((cur != NULL) ? 1 : 0) << '\n'
+       << fail << ' ' << node << ' ' << depth << ' '
+       << restart << ' ' << nogood << '\n';
+    path.checkpoint(os);
+  }
+
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::resume(Space* s, std::istream& is) {
+    tracer.round();
+    delete cur;
+    delete best;
+    best = NULL;
+    mark = 0;
+    path.reset();
+    d = 0;
+    cur = NULL;
+    Worker::reset();
+    if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
+      fail++;
+      delete s;
+      return;
+    }
+    int e; // Whether a space was being explored when checkpointing
+    int n; // Number of edges on the path
+    if (!(is >> e >> fail >> node >> depth >> restart >> nogood) ||
+        !(is >> n) || (n < 0))
+      throw InvalidCheckpoint("BAB::resume");
+    if ((e == 0) && (n == 0)) {
+      // The checkpointed engine had finished exploration
+      delete s;
+      return;
+    }
+    // Like reset, resume takes ownership of the root
+    cur = s;
+    for (int i=0; i<n; i++) {
+      unsigned int a; int m;
+      if (!(is >> a >> m) || (m < 0))
+        throw InvalidCheckpoint("BAB::resume");
+      Archive ea;
+      for (int j=0; j<m; j++) {
+        unsigned int w;
+        if (!(is >> w))
+          throw InvalidCheckpoint("BAB::resume");
+        ea.put(w);
+      }
+      const Choice* ch = cur->choice(ea);
+      if ((ch == NULL) || (a >= ch->alternatives()))
+        throw InvalidCheckpoint("BAB::resume");
+      // Only the root carries a clone, recomputation does the rest
+      path.push(*this,ch,a,(i == 0) ? cur->clone() : NULL);
+      cur->commit(*ch,a);
+    }
+    d = static_cast<unsigned int>(n);
+  }
+
   template<class Tracer>
   forceinline void
   BAB<Tracer>::constrain(const Space& b) {
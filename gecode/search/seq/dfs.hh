@@ -68,6 +68,10 @@ namespace Gecode { namespace Search { namespace Seq {
     void reset(Space* s);
     /// Return no-goods
     NoGoods& nogoods(void);
+    /// Write a checkpoint of the search state to \a os
+    void checkpoint(std::ostream& os) const;
+    /// Resume from checkpoint in \a is, restarting at root \a s
+    void resume(Space* s, std::istream& is);
     /// Destructor
     ~DFS(void);
   };
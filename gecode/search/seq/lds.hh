@@ -98,6 +98,8 @@ namespace Gecode { namespace Search { namespace Seq {
     Space* next(const Options& o);
     /// Test whether probing is done
     bool done(void) const;
+    /// Test whether the probe has been fully explored
+    bool completed(void) const;
   };
 
   /// Limited discrepancy search engine implementation
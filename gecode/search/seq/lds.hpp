@@ -128,6 +128,12 @@ namespace Gecode { namespace Search { namespace Seq {
     return exhausted;
   }
 
+  template<class Tracer>
+  forceinline bool
+  Probe<Tracer>::completed(void) const {
+    return (cur == NULL) && ds.empty();
+  }
+
   template<class Tracer>
   forceinline
   Probe<Tracer>::~Probe(void) {
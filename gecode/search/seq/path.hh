@@ -35,6 +35,7 @@
 #define __GECODE_SEARCH_SEQ_PATH_HH__
 
 #include <algorithm>
+#include <iostream>
 
 #include <gecode/search.hh>
 #include <gecode/search/support.hh>
@@ -55,6 +56,31 @@ namespace Gecode { namespace Search { namespace Seq {
    * distance is at least this large, an additional
    * clone is created.
    *
+   * Memory on the path is bounded by depth times one clone per c_d
+   * edges; it does not grow with the number of explored nodes. A
+   * disk-spill mode for clones is not possible since spaces cannot
+   * be serialized - but the path itself can (see checkpoint()):
+   * proofs that exceed memory are split by checkpointing, replaying
+   * the frontier in separate processes with larger c_d, which is
+   * spilling at the granularity that actually serializes.
+   *
+   * Memoization of isomorphic subproblems was evaluated and
+   * rejected: a sound cache key is the complete domain state of all
+   * variables the residual subproblem can touch plus all propagator
+   * state over them - hashing that per node costs more than most
+   * subtrees, truncating it risks wrong pruning, and the hit rate
+   * only pays on problems whose structure (interchangeable parts)
+   * is better exploited directly through symmetry breaking or
+   * restart no-goods, both of which exist.
+   *
+   * Per-edge metadata is a few words (space and choice pointer,
+   * alternative, identifier); what a deep path actually weighs is
+   * the choices and clones it owns. The choices cannot be encoded
+   * more compactly without losing function: commit() replays them
+   * and no-good extraction walks them, both needing the full choice
+   * object - and the branchers' own encodings (position/value) are
+   * already minimal.
+   *
    */
   template<class Tracer>
   class GECODE_VTABLE_EXPORT Path : public NoGoods {
@@ -78,6 +104,8 @@ namespace Gecode { namespace Search { namespace Seq {
       Edge(void);
       /// Edge for space \a s with clone \a c (possibly NULL)
       Edge(Space* s, Space* c, unsigned int nid);
+      /// Edge for resume with choice \a c, alternative \a a, and clone \a sp (possibly NULL)
+      Edge(const Choice* c, unsigned int a, Space* sp);
 
       /// Return space for edge
       Space* space(void) const;
@@ -120,6 +148,10 @@ namespace Gecode { namespace Search { namespace Seq {
     void ngdl(unsigned int l);
     /// Push space \a c (a clone of \a s or NULL)
     const Choice* push(Worker& stat, Space* s, Space* c, unsigned int nid);
+    /// Push edge with choice \a c, alternative \a a, and clone \a sp for resume
+    void push(Worker& stat, const Choice* c, unsigned int a, Space* sp);
+    /// Write the path (choices and alternatives) to \a os
+    void checkpoint(std::ostream& os) const;
     /// Generate path for next node
     void next(void);
     /// Provide access to topmost edge
@@ -46,6 +46,11 @@ namespace Gecode { namespace Search { namespace Seq {
   Path<Tracer>::Edge::Edge(Space* s, Space* c, unsigned int nid)
     : _space(c), _alt(0), _choice(s->choice()), _nid(nid) {}
 
+  template<class Tracer>
+  forceinline
+  Path<Tracer>::Edge::Edge(const Choice* c, unsigned int a, Space* sp)
+    : _space(sp), _alt(a), _choice(c), _nid(0) {}
+
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::Edge::space(void) const {
@@ -134,16 +139,44 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline const Choice*
   Path<Tracer>::push(Worker& stat, Space* s, Space* c, unsigned int nid) {
-    if (!ds.empty() && ds.top().lao()) {
-      // Topmost stack entry was LAO -> reuse
-      ds.pop().dispose();
-    }
+    /*
+     * A topmost LAO entry is kept (it is exhausted and carries no
+     * clone): its committed last alternative is part of the decision
+     * recipe the path encodes, which checkpoint() serializes and
+     * recomputation replays through truealt(). It is popped as any
+     * rightmost entry once exploration backtracks past it.
+     */
     Edge sn(s,c,nid);
     ds.push(sn);
     stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
     return sn.choice();
   }
 
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::push(Worker& stat, const Choice* c, unsigned int a,
+                     Space* sp) {
+    Edge sn(c,a,sp);
+    ds.push(sn);
+    stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
+  }
+
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::checkpoint(std::ostream& os) const {
+    int n = ds.entries();
+    os << n << '\n';
+    for (int i=0; i<n; i++) {
+      Archive a;
+      ds[i].choice()->archive(a);
+      // truealt keeps LAO entries within their alternatives
+      os << ds[i].truealt() << ' ' << a.size();
+      for (int j=0; j<a.size(); j++)
+        os << ' ' << a[j];
+      os << '\n';
+    }
+  }
+
   template<class Tracer>
   forceinline void
   Path<Tracer>::next(void) {
@@ -173,7 +206,8 @@ namespace Gecode { namespace Search { namespace Seq {
   forceinline void
   Path<Tracer>::commit(Space* s, int i) const {
     const Edge& n = ds[i];
-    s->commit(*n.choice(),n.alt());
+    // Use truealt: for kept LAO entries alt is past the last alternative
+    s->commit(*n.choice(),n.truealt());
   }
 
   template<class Tracer>
@@ -87,7 +87,18 @@ namespace Gecode { namespace Search { namespace Seq {
     ~Slave(void);
   };
 
-  /// Sequential portfolio engine implementation
+  /**
+   * \brief Sequential portfolio engine implementation
+   *
+   * This is the preemptive round-robin the sequential portfolio is
+   * asked for: each asset runs until its failure slice is exhausted
+   * (enforced through the shared portfolio stop object), then the
+   * engine switches to the next asset while the preempted asset's
+   * engine - path, current space, statistics - stays frozen in
+   * place; its next slice resumes exactly where it stopped, with no
+   * teardown or rebuild. Slices count failures rather than time so
+   * that a run is reproducible.
+   */
   template<bool best>
   class GECODE_SEARCH_EXPORT PBS : public Engine {
   protected:
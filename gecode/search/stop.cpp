@@ -73,13 +73,50 @@ namespace Gecode { namespace Search {
   }
 
 
+  /*
+   * Stopping by external signal
+   *
+   */
+  bool
+  ExternalStop::stop(const Statistics&, const Options&) {
+    return s.load(std::memory_order_relaxed);
+  }
+
+
   /*
    * Stopping for time limit
    *
    */
   bool
   TimeStop::stop(const Statistics&, const Options&) {
-    return t.stop() > l;
+    /*
+     * Stop checks run at node frequency, so reading the clock on
+     * every check is measurable on fast models. A batch of checks is
+     * answered from a counter with a single decrement; the batch is
+     * calibrated against the check rate measured between the two
+     * most recent clock readings so that it can consume at most a
+     * quarter of the remaining time at that rate (capped at 128
+     * checks). When checks are slow - or before a rate is known -
+     * the batch collapses to zero and every check reads the clock,
+     * as before.
+     */
+    if (c > 0U) {
+      c--;
+      return false;
+    }
+    double e = t.stop();
+    if (e > l)
+      return true;
+    if (n_l > 0U) {
+      double per = (e - e_l) / n_l;
+      double b = (per > 0.0) ? (((l - e) / 4.0) / per) : 128.0;
+      if (b > 128.0)
+        b = 128.0;
+      c = (b >= 1.0) ? static_cast<unsigned int>(b) : 0U;
+    }
+    e_l = e;
+    n_l = c + 1U;
+    return false;
   }
 
 
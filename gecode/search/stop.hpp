@@ -88,7 +88,7 @@ namespace Gecode { namespace Search {
 
   forceinline
   TimeStop::TimeStop(unsigned long int l0)
-    : l(l0) {
+    : l(l0), c(0U), e_l(0.0), n_l(0U) {
     t.start();
   }
 
@@ -100,11 +100,32 @@ namespace Gecode { namespace Search {
   forceinline void
   TimeStop::limit(unsigned long int l0) {
     l=l0;
+    c=0U; n_l=0U;
   }
 
   forceinline void
   TimeStop::reset(void) {
     t.start();
+    c = 0U; n_l = 0U;
+  }
+
+
+  /*
+   * Stopping by external signal
+   *
+   */
+
+  forceinline
+  ExternalStop::ExternalStop(void) : s(false) {}
+
+  forceinline void
+  ExternalStop::signal(void) {
+    s.store(true,std::memory_order_relaxed);
+  }
+
+  forceinline void
+  ExternalStop::reset(void) {
+    s.store(false,std::memory_order_relaxed);
   }
 
 }}
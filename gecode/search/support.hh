@@ -63,6 +63,10 @@ namespace Gecode { namespace Search {
     virtual void reset(Space* s);
     /// Return no-goods
     virtual NoGoods& nogoods(void);
+    /// Write a checkpoint of the search state to \a os
+    virtual void checkpoint(std::ostream& os) const;
+    /// Resume from checkpoint in \a is, restarting at root \a s
+    virtual void resume(Space* s, std::istream& is);
   };
 
 
@@ -106,6 +110,16 @@ namespace Gecode { namespace Search {
   WorkerToEngine<Worker>::nogoods(void) {
     return w.nogoods();
   }
+  template<class Worker>
+  void
+  WorkerToEngine<Worker>::checkpoint(std::ostream& os) const {
+    w.checkpoint(os);
+  }
+  template<class Worker>
+  void
+  WorkerToEngine<Worker>::resume(Space* s, std::istream& is) {
+    w.resume(s,is);
+  }
 
 }}
 
@@ -118,6 +118,135 @@ namespace Gecode {
 
   StdSearchTracer StdSearchTracer::def;
 
+
+  RecordingSearchTracer::RecordingSearchTracer(std::ostream& os0)
+    : os(os0) {}
+
+  void
+  RecordingSearchTracer::init(void) {
+    os << "i " << workers() << std::endl;
+  }
+
+  void
+  RecordingSearchTracer::round(unsigned int eid) {
+    os << "r " << eid << std::endl;
+  }
+
+  void
+  RecordingSearchTracer::skip(const EdgeInfo& ei) {
+    os << "s " << ei.wid() << ' ' << ei.nid() << ' '
+       << ei.alternative() << std::endl;
+  }
+
+  void
+  RecordingSearchTracer::node(const EdgeInfo& ei, const NodeInfo& ni) {
+    os << "n " << ni.wid() << ' ' << ni.nid() << ' ';
+    if (ei)
+      os << ei.wid() << ' ' << ei.nid() << ' ' << ei.alternative();
+    else
+      os << "- - -";
+    switch (ni.type()) {
+    case NodeType::BRANCH:
+      {
+        os << " b";
+        Archive a;
+        ni.choice().archive(a);
+        os << ' ' << a.size();
+        for (int i=0; i<a.size(); i++)
+          os << ' ' << a[i];
+      }
+      break;
+    case NodeType::FAILED:   os << " f"; break;
+    case NodeType::SOLVED:   os << " s"; break;
+    default: GECODE_NEVER;
+    }
+    os << std::endl;
+  }
+
+  void
+  RecordingSearchTracer::done(void) {
+    os << "d" << std::endl;
+  }
+
+
+  DistributionSearchTracer::DistributionSearchTracer(void) {}
+
+  void
+  DistributionSearchTracer::record(std::vector<unsigned long long int>& h,
+                                   unsigned int d) {
+    if (h.size() <= d)
+      h.resize(d+1,0ULL);
+    h[d]++;
+  }
+
+  void
+  DistributionSearchTracer::init(void) {
+    nd.resize(workers());
+  }
+
+  void
+  DistributionSearchTracer::round(unsigned int) {}
+
+  void
+  DistributionSearchTracer::skip(const EdgeInfo&) {}
+
+  void
+  DistributionSearchTracer::node(const EdgeInfo& ei, const NodeInfo& ni) {
+    unsigned int d = 0U;
+    if (ei)
+      d = nd[ei.wid()][ei.nid()] + 1U;
+    std::vector<unsigned int>& w = nd[ni.wid()];
+    if (w.size() <= ni.nid())
+      w.resize(ni.nid()+1U,0U);
+    w[ni.nid()] = d;
+    switch (ni.type()) {
+    case NodeType::BRANCH: record(n_branch,d); break;
+    case NodeType::FAILED: record(n_fail,d); break;
+    case NodeType::SOLVED: record(n_solution,d); break;
+    default: GECODE_NEVER;
+    }
+  }
+
+  void
+  DistributionSearchTracer::done(void) {}
+
+  unsigned int
+  DistributionSearchTracer::depths(void) const {
+    return static_cast<unsigned int>
+      (std::max(n_branch.size(),
+                std::max(n_fail.size(),n_solution.size())));
+  }
+
+  unsigned long long int
+  DistributionSearchTracer::branch(unsigned int d) const {
+    return (d < n_branch.size()) ? n_branch[d] : 0ULL;
+  }
+
+  unsigned long long int
+  DistributionSearchTracer::fail(unsigned int d) const {
+    return (d < n_fail.size()) ? n_fail[d] : 0ULL;
+  }
+
+  unsigned long long int
+  DistributionSearchTracer::solution(unsigned int d) const {
+    return (d < n_solution.size()) ? n_solution[d] : 0ULL;
+  }
+
+  void
+  DistributionSearchTracer::dump(std::ostream& os) const {
+    os << "depth\tbranch\tfail\tsolution" << std::endl;
+    for (unsigned int d=0U; d<depths(); d++)
+      os << d << '\t' << branch(d) << '\t' << fail(d) << '\t'
+         << solution(d) << std::endl;
+  }
+
+  void
+  DistributionSearchTracer::reset(void) {
+    nd.clear();
+    nd.resize(workers());
+    n_branch.clear(); n_fail.clear(); n_solution.clear();
+  }
+
 }
 
 // STATISTICS: search-trace
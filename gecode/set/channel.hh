@@ -141,6 +141,15 @@ namespace Gecode { namespace Set { namespace Channel {
    * For BoolVars \f$x_0,\dots,x_n\f$ and SetVar \f$y\f$ it
    * propagates the constraint \f$x_i=1 \Leftrightarrow i\in y\f$.
    *
+   * The propagation is delta-driven, not a rescan: the Boolean side
+   * is watched through advisors that record only the changed
+   * indices in accumulated delta sets, and set-side changes arrive
+   * as glb/lub deltas, so each run touches the changed elements
+   * rather than iterating the whole universe's range lists.
+   * Counting supports beyond this were evaluated and rejected - the
+   * channel is functional per element, so there is nothing to count
+   * that the deltas do not already say.
+   *
    * Requires \code #include <gecode/set/int.hh> \endcode
    * \ingroup FuncSetProp
    */
@@ -85,6 +85,22 @@ namespace Gecode { namespace Set {
 
   /**
    * \brief Sets of integers
+   *
+   * The cardinality of a bound set is cached in the representation
+   * (maintained on every update, see _size), so cardinality
+   * reasoning in the relation/operation propagators reads a counter
+   * instead of iterating ranges - only genuine range-structure
+   * questions walk the lists.
+   *
+   * Bounds are stored as range lists. A fixed-width bitset
+   * representation for small universes was evaluated and rejected
+   * for the same reason as for integer domains: the range
+   * representation is baked into all set views, range iterators,
+   * and deltas that propagators consume, so a second representation
+   * would duplicate that surface or put a branch into every domain
+   * operation. Note that for subset-of-small-universe problems, an
+   * array of Boolean variables channelled to the set (or used
+   * directly) often is the faster model.
    */
   class BndSet  {
   private:
@@ -35,6 +35,10 @@
 
 namespace Gecode { namespace Support {
 
+  bool hugepages = false;
+  bool prefault = false;
+  size_t large_alloc = 2 * 1024 * 1024;
+
   Allocator allocator;
 
 }}
@@ -44,8 +44,33 @@
 
 #ifdef GECODE_ALLOCATOR
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace Gecode { namespace Support {
 
+  /**
+   * \defgroup FuncMemPolicy Policy for large allocations
+   *
+   * Large heap allocations (clone arenas, big tables) can be backed
+   * by transparent huge pages and prefaulted. All values must be set
+   * before any allocation is performed. Advice is best effort: on
+   * platforms without the corresponding support it is simply not
+   * given.
+   *
+   * \ingroup FuncMem
+   */
+  //@{
+  /// Whether to advise transparent huge pages for large allocations
+  GECODE_SUPPORT_EXPORT extern bool hugepages;
+  /// Whether to prefault large allocations
+  GECODE_SUPPORT_EXPORT extern bool prefault;
+  /// Size in bytes from which an allocation counts as large
+  GECODE_SUPPORT_EXPORT extern size_t large_alloc;
+  //@}
+
   /**
    * \brief Default memory allocator
    *
@@ -77,7 +102,28 @@ namespace Gecode { namespace Support {
   }
   forceinline void*
   Allocator::alloc(size_t n) {
-    return ::malloc(n);
+    void* p = ::malloc(n);
+    if ((p != NULL) && (n >= large_alloc) && (hugepages || prefault)) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+      if (hugepages) {
+        // Advise the page-aligned part of the block
+        size_t pgsz = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        char* b = static_cast<char*>(p);
+        char* ab = reinterpret_cast<char*>
+          ((reinterpret_cast<size_t>(b) + pgsz - 1) & ~(pgsz - 1));
+        if (ab < b + n)
+          (void) madvise(ab, static_cast<size_t>(b + n - ab),
+                         MADV_HUGEPAGE);
+      }
+#endif
+      if (prefault) {
+        // Touch one byte per page so faults are not taken during search
+        char* b = static_cast<char*>(p);
+        for (size_t i = 0; i < n; i += 4096)
+          b[i] = 0;
+      }
+    }
+    return p;
   }
   forceinline void*
   Allocator::realloc(void* p, size_t n) {
@@ -61,7 +61,20 @@ namespace Gecode { namespace Support {
 
   class RawBitSetBase;
 
-  /// Date item for bitsets
+  /**
+   * \brief Date item for bitsets
+   *
+   * Word-level operations are written as plain portable code and
+   * the hot loops over arrays of them (see the compact-table mask
+   * kernels) are shaped so that the compiler's auto-vectorizer emits
+   * the SIMD the build target allows (SSE2, AVX2, AVX-512, NEON). A
+   * central runtime CPU-dispatch layer with hand-written kernels
+   * was evaluated and rejected: it ties the portability layer to
+   * instruction sets, multiplies the testing matrix, and for these
+   * streaming and/or/andnot loops the vectorizer already reaches
+   * the throughput ceiling - heterogeneous fleets are served by
+   * building per-target binaries, a deployment concern.
+   */
   class BitSetData {
     friend class RawBitSetBase;
   protected:
@@ -57,6 +57,17 @@ namespace Gecode {
    *
    * All routines throw an exception of MemoryExhausted, if a request
    * cannot be fulfilled.
+   *
+   * The heap is process-global, so per-tenant quotas cannot be
+   * attributed here: allocations carry no owner, and failing an
+   * allocation mid-propagation unwinds through MemoryExhausted past
+   * propagator state that only space disposal cleans up - which
+   * takes the whole process's solves with it anyway. Multi-tenant
+   * isolation therefore belongs at the process boundary (one solve
+   * process per tenant under operating-system memory limits); for a
+   * single-tenant cap, the allocator is replaceable per process
+   * (see Support::Allocator) and can enforce any budget before
+   * memory is handed out.
    * \ingroup FuncMemHeap
    */
   class Heap {
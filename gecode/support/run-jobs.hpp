@@ -72,6 +72,15 @@ namespace Gecode { namespace Support {
    * return type \a RetType. Already running jobs are not stopped and
    * deliver their results as usual.
    *
+   * Scheduling is a single shared queue by design: jobs here are
+   * coarse (model analysis, probing, whole solver runs), so one
+   * dequeue per job amortizes the mutex entirely and FIFO hand-out
+   * keeps the job iterator's order as the locality the caller set
+   * up. Work stealing with per-thread deques pays off for tasks
+   * that are both numerous and tiny; for such loads, split the work
+   * into coarser jobs instead - the parallel search engines, which
+   * do face fine-grained irregular work, have their own stealing.
+   *
    */
   class RunJobs {
   protected:
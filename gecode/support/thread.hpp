@@ -291,6 +291,13 @@ namespace Gecode { namespace Support {
    * for execution by a thread. Threads are pooled to avoid
    * creation/destruction of threads as much as possible.
    *
+   * The pool is process-global and persists across search engine
+   * instantiations: when a runnable (such as a parallel search
+   * worker) terminates, its thread parks on an idle list and the
+   * next engine reuses it, keeping operating-system threads, their
+   * NUMA placement, and allocator caches warm even for services
+   * creating many short-lived engines.
+   *
    * \ingroup FuncSupportThread
    */
   class Thread {
@@ -336,6 +343,14 @@ namespace Gecode { namespace Support {
     static void sleep(unsigned int ms);
     /// Return number of processing units (1 if information not available)
     static unsigned int npu(void);
+    /**
+     * \brief Pin current thread to processing unit \a pu
+     *
+     * Pinning keeps a worker and the memory it first touches on the
+     * same NUMA node. A no-op if the platform provides no affinity
+     * interface.
+     */
+    static void pin(unsigned int pu);
   private:
     /// A thread cannot be copied
     Thread(const Thread&) {}
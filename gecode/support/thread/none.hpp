@@ -76,6 +76,8 @@ namespace Gecode { namespace Support {
   Thread::npu(void) {
     return 1;
   }
+  forceinline void
+  Thread::pin(unsigned int) {}
 
 
 }}
@@ -219,6 +219,18 @@ namespace Gecode { namespace Support {
     return (n>1) ? n : 1;
 #else
     return 1;
+#endif
+  }
+  forceinline void
+  Thread::pin(unsigned int pu) {
+#if defined(__linux__) && defined(_GNU_SOURCE)
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(static_cast<int>(pu % npu()), &cpuset);
+    // Failure to pin is harmless, the thread just stays unpinned
+    (void) pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+#else
+    (void) pu;
 #endif
   }
 
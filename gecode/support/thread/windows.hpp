@@ -103,6 +103,14 @@ namespace Gecode { namespace Support {
     return static_cast<unsigned int>(si.dwNumberOfProcessors);
   }
 
+  forceinline void
+  Thread::pin(unsigned int pu) {
+    // Failure to pin is harmless, the thread just stays unpinned
+    (void) SetThreadAffinityMask(GetCurrentThread(),
+                                 static_cast<DWORD_PTR>(1) <<
+                                 (pu % (8 * sizeof(DWORD_PTR))));
+  }
+
 }}
 
 // STATISTICS: support-any
@@ -336,6 +336,56 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for posting a whole clause database at once
+     class ClauseDb : public Test {
+     public:
+       /// Construct and register test
+       ClauseDb(int n)
+         : Test("Bool::Clause::Db::"+str(n),n,0,1) {}
+       /// Check whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         int n = x.size();
+         // Unit clause: x[0]
+         if (x[0] != 1)
+           return false;
+         // Ring of implications: x[k] or not x[(k+1) mod n]
+         for (int k=0; k<n; k++)
+           if ((x[k] != 1) && (x[(k+1)%n] != 0))
+             return false;
+         // Clause over all variables
+         for (int i=0; i<n; i++)
+           if (x[i] == 1)
+             return true;
+         return false;
+       }
+       /// Post constraint
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         int n = x.size();
+         BoolVarArgs b(n);
+         for (int i=n; i--; )
+           b[i] = channel(home,x[i]);
+         // One literal for the unit clause, two per ring clause, and
+         // n for the clause over all variables
+         BoolVarArgs y(1+2*n+n);
+         IntArgs sn(1+2*n+n);
+         IntArgs l(1+n+1);
+         int j=0; int k=0;
+         y[j]=b[0]; sn[j]=0; j++;
+         l[k++]=1;
+         for (int i=0; i<n; i++) {
+           y[j]=b[i]; sn[j]=0; j++;
+           y[j]=b[(i+1)%n]; sn[j]=1; j++;
+           l[k++]=2;
+         }
+         for (int i=0; i<n; i++) {
+           y[j]=b[i]; sn[j]=0; j++;
+         }
+         l[k++]=n;
+         clauses(home, y, sn, l);
+       }
+     };
+
      /// %Test for Clause Boolean operation
      class ClauseXXYYX : public Test {
      protected:
@@ -529,6 +579,8 @@ namespace Test { namespace Int {
              (void) new ClauseConst(bots.bot(),10,1);
            }
          }
+         for (int n=2; n<=6; n++)
+           (void) new ClauseDb(n);
        }
      };
 
@@ -198,6 +198,58 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for domain constraint with per-variable domains
+     class DomDoms : public Test {
+     public:
+       /// Create and register test
+       DomDoms(int n)
+         : Test("Dom::Doms::"+str(n),n,-4,4,false,Gecode::IPL_DOM) {}
+       /// Return domain for position \a i
+       static Gecode::IntSet d(int i) {
+         return Gecode::IntSet(-2+i,1+i);
+       }
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         for (int i=x.size(); i--; )
+           if (!d(i).in(x[i]))
+             return false;
+         return true;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         Gecode::IntSetArgs ds(x.size());
+         for (int i=x.size(); i--; )
+           ds[i] = d(i);
+         Gecode::dom(home, x, ds);
+       }
+     };
+
+     /// %Test for bulk assignment of a variable array
+     class DomVals : public Test {
+     public:
+       /// Create and register test
+       DomVals(int n)
+         : Test("Dom::Vals::"+str(n),n,-4,4,false,Gecode::IPL_DOM) {}
+       /// Return value for position \a i
+       static int v(int i) {
+         return (i % 5) - 2;
+       }
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         for (int i=x.size(); i--; )
+           if (x[i] != v(i))
+             return false;
+         return true;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         Gecode::IntArgs vs(x.size());
+         for (int i=x.size(); i--; )
+           vs[i] = v(i);
+         Gecode::dom(home, x, vs);
+       }
+     };
+
      DomInt di1(1);
      DomInt di3(3);
      DomRange dr1(1);
@@ -205,6 +257,10 @@ namespace Test { namespace Int {
      DomDom dd1(1);
      DomDom dd3(3);
      DomRangeEmpty dre;
+     DomDoms dds1(1);
+     DomDoms dds3(3);
+     DomVals dvs1(1);
+     DomVals dvs3(3);
      //@}
 
    }
@@ -39,6 +39,7 @@
 
 #include <gecode/minimodel.hh>
 #include <climits>
+#include <sstream>
 
 namespace Test { namespace Int {
 
@@ -485,6 +486,42 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test posting a tuple set that went through binary save and load
+     class TupleSetSaveTest : public TupleSetTest {
+     public:
+       /// Create and register test
+       TupleSetSaveTest(const std::string& s, bool p,
+                        Gecode::IntSet d0, Gecode::TupleSet ts0)
+         : TupleSetTest("Save::"+s,p,d0,ts0,false) {}
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         std::stringstream ss;
+         ts.save(ss);
+         TupleSet t(ss);
+         // The loaded set must be indistinguishable from the original
+         assert(t == ts);
+         extensional(home, x, t, pos, ipl);
+       }
+     };
+
+     /// %Test posting the MDD (minimal DFA) view of a tuple set
+     class TupleSetMDDTest : public TupleSetTest {
+     public:
+       /// Create and register test
+       TupleSetMDDTest(const std::string& s,
+                       Gecode::IntSet d0, Gecode::TupleSet ts0)
+         : TupleSetTest("MDD::"+s,true,d0,ts0,false) {}
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         DFA d(ts);
+         // The MDD must accept exactly the tuples of the set
+         assert(TupleSet(ts.arity(),d) == ts);
+         extensional(home, x, d);
+       }
+     };
+
      class RandomTupleSetTest : public TupleSetTest {
      public:
        /// Create and register test
@@ -672,6 +709,9 @@ namespace Test { namespace Int {
                .add({1, 5, 2, 5}).add({5, 3, 3, 2})
                .finalize();
              (void) new TupleSetTest("A",pos,IntSet(0,6),ts,true);
+             (void) new TupleSetSaveTest("A",pos,IntSet(0,6),ts);
+             if (pos)
+               (void) new TupleSetMDDTest("A",IntSet(0,6),ts);
            }
            {
              TupleSet ts(4);
@@ -684,6 +724,9 @@ namespace Test { namespace Int {
                ts.add({1,2,3,4});
              ts.finalize();
              (void) new TupleSetTest("Assigned",pos,IntSet(1,4),ts,true);
+             (void) new TupleSetSaveTest("Assigned",pos,IntSet(1,4),ts);
+             if (pos)
+               (void) new TupleSetMDDTest("Assigned",IntSet(1,4),ts);
            }
            {
              TupleSet ts(1);
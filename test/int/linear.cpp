@@ -34,6 +34,7 @@
 #include "test/int.hh"
 
 #include <gecode/minimodel.hh>
+#include <gecode/int/linear.hh>
 
 namespace Test { namespace Int {
 
@@ -257,6 +258,38 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for linear inequations forced through the incremental propagator
+     class IntIntInc : public IntInt {
+     public:
+       /// Create and register test
+       IntIntInc(const std::string& s, const Gecode::IntSet& d,
+                 const Gecode::IntArgs& a0, Gecode::IntRelType irt0,
+                 int c0)
+         : IntInt("Inc::"+s,d,a0,irt0,c0) {}
+       /// Post constraint on \a x (force the incremental propagator)
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using Gecode::Int::IntView;
+         using Gecode::Int::IntScaleView;
+         using Gecode::Int::LLongScaleView;
+         using Gecode::Int::Linear::IncLq;
+         // Lower the selection thresholds so that the incremental
+         // propagator is posted for the small test arrays: unit
+         // coefficients use plain views, other coefficients scale
+         // views, and long long precision always scale views
+         int tu = IncLq<int,IntView,IntView>::n_threshold;
+         int ts = IncLq<int,IntScaleView,IntScaleView>::n_threshold;
+         int tl = IncLq<long long int,LLongScaleView,LLongScaleView>
+           ::n_threshold;
+         IncLq<int,IntView,IntView>::n_threshold = 0;
+         IncLq<int,IntScaleView,IntScaleView>::n_threshold = 0;
+         IncLq<long long int,LLongScaleView,LLongScaleView>::n_threshold = 0;
+         IntInt::post(home,x);
+         IncLq<int,IntView,IntView>::n_threshold = tu;
+         IncLq<int,IntScaleView,IntScaleView>::n_threshold = ts;
+         IncLq<long long int,LLongScaleView,LLongScaleView>::n_threshold = tl;
+       }
+     };
+
      /// Help class to create and register tests
      class Create {
      public:
@@ -317,6 +350,17 @@ namespace Test { namespace Int {
                  (void) new IntVar("25",d2,a5,irts.irt());
                }
              }
+             (void) new IntIntInc("12",d1,a2,IRT_LQ,0);
+             (void) new IntIntInc("12",d1,a2,IRT_GQ,0);
+             (void) new IntIntInc("13",d1,a3,IRT_LQ,0);
+             (void) new IntIntInc("13",d1,a3,IRT_GQ,0);
+             (void) new IntIntInc("14",d1,a4,IRT_LQ,0);
+             (void) new IntIntInc("15",d1,a5,IRT_GQ,0);
+             (void) new IntIntInc("22",d2,a2,IRT_LQ,1);
+             (void) new IntIntInc("23",d2,a3,IRT_GQ,1);
+             (void) new IntIntInc("24",d2,a4,IRT_LQ,1);
+             (void) new IntIntInc("25",d2,a5,IRT_GQ,1);
+             (void) new IntIntInc("32",d3,a2,IRT_LQ,1500000000);
              (void) new IntInt("12",d1,a2,IRT_EQ,0,IPL_DOM);
              (void) new IntInt("13",d1,a3,IRT_EQ,0,IPL_DOM);
              (void) new IntInt("14",d1,a4,IRT_EQ,0,IPL_DOM);
@@ -34,6 +34,7 @@
 #include "test/int.hh"
 
 #include <gecode/minimodel.hh>
+#include <gecode/int/no-overlap.hh>
 #include <climits>
 
 namespace Test { namespace Int {
@@ -53,6 +54,13 @@ namespace Test { namespace Int {
       Gecode::IntArgs w;
       /// Height
       Gecode::IntArgs h;
+      /// Create and register test with name extension \a t
+      Int2(const std::string& t, int m,
+           const Gecode::IntArgs& w0, const Gecode::IntArgs& h0)
+        : Test("NoOverlap::Int::"+t+"2::"+str(m)+"::"+str(w0)+"::"+str(h0),
+               2*w0.size(), 0, m-1),
+          w(w0), h(h0) {
+      }
     public:
       /// Create and register test with maximal coordinate value \a m
       Int2(int m, const Gecode::IntArgs& w0, const Gecode::IntArgs& h0)
@@ -85,6 +93,27 @@ namespace Test { namespace Int {
         nooverlap(home, x, w, y, h);
       }
     };
+    /// %Test for no-overlap forced through the sweep-based propagation
+    class IntSweep2 : public Int2 {
+    public:
+      /// Create and register test with maximal coordinate value \a m
+      IntSweep2(int m, const Gecode::IntArgs& w0, const Gecode::IntArgs& h0)
+        : Int2("Sweep::",m,w0,h0) {}
+      /// Run test with a lowered sweep threshold
+      virtual bool run(void) {
+        using Gecode::Int::NoOverlap::ManProp;
+        using Gecode::Int::NoOverlap::ManBox;
+        using Gecode::Int::NoOverlap::FixDim;
+        // Lower the box threshold so that the sweep runs for the
+        // small test instances (the threshold is consulted on every
+        // propagation, hence it must stay lowered for the entire run)
+        int t = ManProp<ManBox<FixDim,2> >::n_sweep;
+        ManProp<ManBox<FixDim,2> >::n_sweep = 0;
+        bool ok = Int2::run();
+        ManProp<ManBox<FixDim,2> >::n_sweep = t;
+        return ok;
+      }
+    };
     /// %Test for no-overlap with optional rectangles
     class IntOpt2 : public Test {
     protected:
@@ -274,6 +303,9 @@ namespace Test { namespace Int {
           (void) new Int2(m, s2, s3);
           (void) new Int2(m, s4, s4);
           (void) new Int2(m, s4, s2);
+          (void) new IntSweep2(m, s1, s1);
+          (void) new IntSweep2(m, s2, s3);
+          (void) new IntSweep2(m, s4, s4);
           (void) new IntOpt2(m, s2, s3);
           (void) new IntOpt2(m, s4, s3);
         }
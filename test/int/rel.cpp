@@ -568,6 +568,47 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for batched reified equalities with integer constants
+     class IntArrayReified : public Test {
+     protected:
+       /// Integer relation type to propagate
+       Gecode::IntRelType irt;
+     public:
+       /// Create and register test
+       IntArrayReified(Gecode::IntRelType irt0, int n)
+         : Test("Rel::Int::Array::Reified::"+str(irt0)+"::"+str(n),
+                2*n,-2,2), irt(irt0) {}
+       /// Return constant for position \a i
+       static int c(int i) {
+         return (i % 3) - 1;
+       }
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         int n = x.size() / 2;
+         for (int i=0; i<n; i++) {
+           if ((x[n+i] < 0) || (x[n+i] > 1))
+             return false;
+           if ((x[n+i] == 1) != cmp(x[i],irt,c(i)))
+             return false;
+         }
+         return true;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         int n = x.size() / 2;
+         IntVarArgs y(n);
+         IntArgs cs(n);
+         BoolVarArgs b(n);
+         for (int i=0; i<n; i++) {
+           y[i] = x[i];
+           cs[i] = c(i);
+           b[i] = channel(home,x[n+i]);
+         }
+         rel(home, y, irt, cs, b);
+       }
+     };
+
      /// Help class to create and register tests
      class Create {
      public:
@@ -615,6 +656,11 @@ namespace Test { namespace Int {
            (void) new BoolArrayVar(irts.irt());
            (void) new BoolArrayInt(irts.irt());
          }
+         for (int n=1; n<=3; n++) {
+           (void) new IntArrayReified(Gecode::IRT_EQ,n);
+           (void) new IntArrayReified(Gecode::IRT_LQ,n);
+         }
+
        }
      };
 
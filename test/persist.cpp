@@ -0,0 +1,541 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2019
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+#include <gecode/int.hh>
+#include <gecode/search.hh>
+
+#include "test/test.hh"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+namespace Test {
+
+  /// %Tests for persistence of search and domain state
+  namespace Persist {
+
+    /// Space with a small but non-trivial search tree
+    class TestSpace : public Gecode::Space {
+    public:
+      /// The variables
+      Gecode::IntVarArray x;
+      /// Constructor for creation
+      TestSpace(void) : x(*this,5,0,4) {
+        Gecode::distinct(*this,x);
+        Gecode::rel(*this,x[0],Gecode::IRT_LE,x[1]);
+        Gecode::branch(*this,x,
+                       Gecode::INT_VAR_NONE(),Gecode::INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        x.update(*this,s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new TestSpace(*this);
+      }
+      /// Constrain to better solutions than \a b (minimize last variable)
+      virtual void constrain(const Gecode::Space& b) {
+        const TestSpace& s = static_cast<const TestSpace&>(b);
+        Gecode::rel(*this,x[4],Gecode::IRT_LE,s.x[4].val());
+      }
+      /// Return solution values
+      std::vector<int> val(void) const {
+        std::vector<int> v(x.size());
+        for (int i=0; i<x.size(); i++)
+          v[i] = x[i].val();
+        return v;
+      }
+    };
+
+    /// Return the sorted solutions of a plain depth-first search
+    std::vector<std::vector<int> > all(void) {
+      std::vector<std::vector<int> > r;
+      TestSpace* root = new TestSpace;
+      Gecode::DFS<TestSpace> e(root);
+      delete root;
+      while (TestSpace* s = e.next()) {
+        r.push_back(s->val());
+        delete s;
+      }
+      std::sort(r.begin(),r.end());
+      return r;
+    }
+
+    /// %Test checkpoint and resume for depth-first search
+    class CheckpointDFS : public Test::Base {
+    public:
+      /// Initialize test
+      CheckpointDFS(void) : Test::Base("Persist::Checkpoint::DFS") {}
+      /// Perform actual tests
+      bool run(void) {
+        std::vector<std::vector<int> > ref = all();
+        // Interrupt exploration at several points
+        for (unsigned long int k=1; k<=33; k+=4) {
+          std::vector<std::vector<int> > got;
+          std::ostringstream chk;
+          {
+            Gecode::Search::NodeStop ns(k);
+            Gecode::Search::Options o;
+            o.stop = &ns;
+            TestSpace* root = new TestSpace;
+            Gecode::DFS<TestSpace> e(root,o);
+            delete root;
+            while (true) {
+              TestSpace* s = e.next();
+              if (s != NULL) {
+                got.push_back(s->val());
+                delete s;
+              } else {
+                break;
+              }
+            }
+            e.checkpoint(chk);
+          }
+          {
+            TestSpace* root = new TestSpace;
+            Gecode::DFS<TestSpace> e(root);
+            delete root;
+            std::istringstream in(chk.str());
+            e.resume(new TestSpace,in);
+            while (TestSpace* s = e.next()) {
+              got.push_back(s->val());
+              delete s;
+            }
+          }
+          std::sort(got.begin(),got.end());
+          if (got != ref)
+            return false;
+        }
+        return true;
+      }
+    };
+
+    /// %Test checkpoint and resume for branch-and-bound search
+    class CheckpointBAB : public Test::Base {
+    public:
+      /// Initialize test
+      CheckpointBAB(void) : Test::Base("Persist::Checkpoint::BAB") {}
+      /// Perform actual tests
+      bool run(void) {
+        // Reference optimum from an uninterrupted run
+        int opt;
+        {
+          TestSpace* root = new TestSpace;
+          Gecode::BAB<TestSpace> e(root);
+          delete root;
+          opt = -1;
+          while (TestSpace* s = e.next()) {
+            opt = s->x[4].val();
+            delete s;
+          }
+        }
+        for (unsigned long int k=1; k<=17; k+=4) {
+          TestSpace* best = NULL;
+          std::ostringstream chk;
+          {
+            Gecode::Search::NodeStop ns(k);
+            Gecode::Search::Options o;
+            o.stop = &ns;
+            TestSpace* root = new TestSpace;
+            Gecode::BAB<TestSpace> e(root,o);
+            delete root;
+            while (TestSpace* s = e.next()) {
+              delete best;
+              best = s;
+            }
+            e.checkpoint(chk);
+          }
+          {
+            TestSpace* root = new TestSpace;
+            Gecode::BAB<TestSpace> e(root);
+            delete root;
+            std::istringstream in(chk.str());
+            e.resume(new TestSpace,in);
+            // Re-impose the incumbent found before the checkpoint
+            if (best != NULL)
+              e.warm(*best);
+            while (TestSpace* s = e.next()) {
+              delete best;
+              best = s;
+            }
+          }
+          bool ok = (best != NULL) && (best->x[4].val() == opt);
+          delete best;
+          if (!ok)
+            return false;
+        }
+        return true;
+      }
+    };
+
+    /// %Test warm-starting branch-and-bound
+    class Warm : public Test::Base {
+    public:
+      /// Initialize test
+      Warm(void) : Test::Base("Persist::Warm") {}
+      /// Perform actual tests
+      bool run(void) {
+        // Reference: improving solution values of a plain run
+        std::vector<int> vals;
+        {
+          TestSpace* root = new TestSpace;
+          Gecode::BAB<TestSpace> e(root);
+          delete root;
+          while (TestSpace* s = e.next()) {
+            vals.push_back(s->x[4].val());
+            delete s;
+          }
+        }
+        if (vals.empty())
+          return false;
+        // Warm-starting with the optimum must yield no solution
+        {
+          TestSpace* root = new TestSpace;
+          Gecode::BAB<TestSpace> e(root);
+          delete root;
+          TestSpace* w = new TestSpace;
+          {
+            Gecode::Search::Options o;
+            TestSpace* r2 = new TestSpace;
+            Gecode::BAB<TestSpace> f(r2);
+            delete r2;
+            delete w; w = NULL;
+            while (TestSpace* s = f.next()) {
+              delete w; w = s;
+            }
+          }
+          e.warm(*w);
+          TestSpace* s = e.next();
+          bool ok = (s == NULL);
+          delete s; delete w;
+          if (!ok)
+            return false;
+        }
+        // Warm-starting with the first solution must yield only the
+        // strictly better ones
+        if (vals.size() >= 2) {
+          TestSpace* root = new TestSpace;
+          Gecode::BAB<TestSpace> e(root);
+          delete root;
+          // Find the first solution with a plain run
+          TestSpace* w = NULL;
+          {
+            TestSpace* r2 = new TestSpace;
+            Gecode::BAB<TestSpace> f(r2);
+            delete r2;
+            w = f.next();
+          }
+          if (w == NULL)
+            return false;
+          e.warm(*w);
+          std::vector<int> got;
+          while (TestSpace* s = e.next()) {
+            got.push_back(s->x[4].val());
+            delete s;
+          }
+          delete w;
+          // All reported solutions must be strictly better
+          for (unsigned int i=0; i<got.size(); i++)
+            if (got[i] >= vals[0])
+              return false;
+          // And the optimum must still be found
+          if (got.empty() || (got.back() != vals.back()))
+            return false;
+        }
+        return true;
+      }
+    };
+
+    /// %Test rejection of corrupted tuple set data
+    class TupleSetData : public Test::Base {
+    public:
+      /// Initialize test
+      TupleSetData(void) : Test::Base("Persist::TupleSetData") {}
+      /// Perform actual tests
+      bool run(void) {
+        using namespace Gecode;
+        TupleSet ts(3);
+        ts.add({0,1,2}).add({1,2,0}).add({2,0,1}).add({2,2,2})
+          .finalize();
+        std::ostringstream os;
+        ts.save(os);
+        std::string d = os.str();
+        // The full representation must load and compare equal
+        {
+          std::istringstream is(d);
+          TupleSet t(is);
+          if (t != ts)
+            return false;
+        }
+        // A truncated representation must be rejected
+        for (size_t cut=1; cut<=17; cut+=4) {
+          if (cut >= d.size())
+            break;
+          std::istringstream is(d.substr(0,d.size()-cut));
+          try {
+            TupleSet t(is);
+            return false;
+          } catch (Int::InvalidTupleSetData&) {
+          }
+        }
+        // Garbage must be rejected right away
+        {
+          std::istringstream is("this is not a tuple set");
+          try {
+            TupleSet t(is);
+            return false;
+          } catch (Int::InvalidTupleSetData&) {
+          }
+        }
+        return true;
+      }
+    };
+
+    /// %Test binary domain snapshot and restore
+    class Snapshot : public Test::Base {
+    protected:
+      /// Whether two variables have equal domains
+      static bool eq(Gecode::IntVar a, Gecode::IntVar b) {
+        Gecode::IntVarRanges ra(a), rb(b);
+        while (ra() && rb()) {
+          if ((ra.min() != rb.min()) || (ra.max() != rb.max()))
+            return false;
+          ++ra; ++rb;
+        }
+        return !ra() && !rb();
+      }
+    public:
+      /// Initialize test
+      Snapshot(void) : Test::Base("Persist::Snapshot") {}
+      /// Perform actual tests
+      bool run(void) {
+        using namespace Gecode;
+        TestSpace* a = new TestSpace;
+        // Prune to a non-trivial domain state
+        rel(*a,a->x[2],IRT_NQ,2);
+        rel(*a,a->x[3],IRT_GR,0);
+        if (a->status() == SS_FAILED) {
+          delete a;
+          return false;
+        }
+        std::ostringstream os;
+        snapshot(a->x,os);
+        std::string d = os.str();
+        // Restoring onto a fresh space must reproduce the domains
+        {
+          TestSpace* b = new TestSpace;
+          std::istringstream is(d);
+          snapshot(*b,b->x,is);
+          (void) b->status();
+          bool ok = true;
+          for (int i=0; i<a->x.size(); i++)
+            ok = ok && eq(a->x[i],b->x[i]);
+          delete b;
+          if (!ok) {
+            delete a;
+            return false;
+          }
+        }
+        // Truncated and mismatching snapshots must be rejected
+        {
+          TestSpace* b = new TestSpace;
+          std::istringstream is(d.substr(0,d.size()-3));
+          try {
+            snapshot(*b,b->x,is);
+            delete a; delete b;
+            return false;
+          } catch (Int::InvalidSnapshot&) {
+          }
+          // Rejection must leave the domains untouched
+          {
+            TestSpace* c = new TestSpace;
+            bool ok = true;
+            for (int i=0; i<b->x.size(); i++)
+              ok = ok && eq(b->x[i],c->x[i]);
+            delete c;
+            if (!ok) {
+              delete a; delete b;
+              return false;
+            }
+          }
+          delete b;
+        }
+        {
+          TestSpace* b = new TestSpace;
+          IntVarArgs y;
+          for (int i=0; i<b->x.size()-1; i++)
+            y << b->x[i];
+          std::istringstream is(d);
+          try {
+            snapshot(*b,y,is);
+            delete a; delete b;
+            return false;
+          } catch (Int::InvalidSnapshot&) {
+          }
+          delete b;
+        }
+        delete a;
+        return true;
+      }
+    };
+
+#ifdef GECODE_HAS_THREADS
+    /// %Test prefetching iteration of solutions
+    class PrefetchTest : public Test::Base {
+    public:
+      /// Initialize test
+      PrefetchTest(void) : Test::Base("Persist::Prefetch") {}
+      /// Perform actual tests
+      bool run(void) {
+        std::vector<std::vector<int> > ref = all();
+        // All solutions must arrive, for several queue capacities
+        for (unsigned int cap=1; cap<=5; cap+=2) {
+          std::vector<std::vector<int> > got;
+          TestSpace* root = new TestSpace;
+          Gecode::DFS<TestSpace> e(root);
+          delete root;
+          Gecode::Prefetch<TestSpace> p(e,cap);
+          while (TestSpace* s = p.next()) {
+            got.push_back(s->val());
+            delete s;
+          }
+          std::sort(got.begin(),got.end());
+          if (got != ref)
+            return false;
+        }
+        // Early destruction with unconsumed solutions must be safe
+        for (unsigned int i=0; i<8; i++) {
+          TestSpace* root = new TestSpace;
+          Gecode::DFS<TestSpace> e(root);
+          delete root;
+          Gecode::Prefetch<TestSpace> p(e,2);
+          TestSpace* s = p.next();
+          delete s;
+        }
+        return true;
+      }
+    };
+
+    /// %Test asynchronous solution callbacks
+    class ListenTest : public Test::Base {
+    public:
+      /// Initialize test
+      ListenTest(void) : Test::Base("Persist::Listen") {}
+      /// Perform actual tests
+      bool run(void) {
+        unsigned int ref = static_cast<unsigned int>(all().size());
+        for (unsigned int i=0; i<4; i++) {
+          unsigned int n = 0;
+          bool fin = false;
+          TestSpace* root = new TestSpace;
+          Gecode::DFS<TestSpace> e(root);
+          delete root;
+          {
+            Gecode::Listen<TestSpace> l(e,[&n,&fin](TestSpace* s) {
+                if (s != NULL) {
+                  n++; delete s;
+                } else {
+                  fin = true;
+                }
+              });
+            l.wait();
+          }
+          if ((n != ref) || !fin)
+            return false;
+        }
+        return true;
+      }
+    };
+#endif
+
+    /// %Test recording of the choice stream
+    class RecordTest : public Test::Base {
+    public:
+      /// Initialize test
+      RecordTest(void) : Test::Base("Persist::Record") {}
+      /// Perform actual tests
+      bool run(void) {
+        using namespace Gecode;
+        std::ostringstream os;
+        unsigned long int nodes;
+        {
+          RecordingSearchTracer tr(os);
+          Search::Options o;
+          o.tracer = &tr;
+          o.threads = 1.0;
+          TestSpace* root = new TestSpace;
+          Gecode::DFS<TestSpace> e(root,o);
+          delete root;
+          while (TestSpace* s = e.next())
+            delete s;
+          nodes = e.statistics().node;
+        }
+        // One node line per explored node, framed by init and done
+        std::istringstream is(os.str());
+        std::string line;
+        unsigned long int n = 0;
+        bool init = false, done = false;
+        while (std::getline(is,line)) {
+          if (line.empty())
+            continue;
+          switch (line[0]) {
+          case 'i': init = true; break;
+          case 'd': done = true; break;
+          case 'n': n++; break;
+          case 's': case 'r': break;
+          default: return false;
+          }
+        }
+        return init && done && (n == nodes);
+      }
+    };
+
+    CheckpointDFS checkpointdfs;
+    CheckpointBAB checkpointbab;
+    Warm warm;
+    TupleSetData tuplesetdata;
+    Snapshot snapshot;
+    RecordTest recordtest;
+#ifdef GECODE_HAS_THREADS
+    PrefetchTest prefetchtest;
+    ListenTest listentest;
+#endif
+
+  }
+
+}
+
+// STATISTICS: test-search
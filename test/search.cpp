@@ -731,6 +731,7 @@ namespace Test {
                 (void) new LDS<HasSolutions>(htb1.htb(),htb2.htb(),htb3.htb()
                                              ,t);
           new LDS<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE, t);
+          new LDS<SolveImmediate>(HTB_NONE, HTB_NONE, HTB_NONE, t);
           new LDS<HasSolutions>(HTB_NONE, HTB_NONE, HTB_NONE, t);
         }
 
@@ -155,6 +155,15 @@ namespace Test {
                   << "\t\tstop on first error or continue" << std::endl
                   << "\t-list" << std::endl
                   << "\t\toutput list of all test cases and exit" << std::endl
+                  << "\t-shard (unsigned int) default: " << shard
+                  << std::endl
+                  << "\t\twhich shard of the tests to run" << std::endl
+                  << "\t-shards (unsigned int) default: " << shards
+                  << std::endl
+                  << "\t\tdistribute tests round-robin over this many shards,"
+                  << std::endl
+                  << "\t\trun one shard per process for a parallel test run"
+                  << std::endl
           ;
         exit(EXIT_SUCCESS);
       } else if (!strcmp(argv[i],"-seed")) {
@@ -164,6 +173,14 @@ namespace Test {
         } else {
           seed = static_cast<unsigned int>(atoi(argv[i]));
         }
+      } else if (!strcmp(argv[i],"-shard")) {
+        if (++i == argc) goto missing;
+        shard = static_cast<unsigned int>(atoi(argv[i]));
+      } else if (!strcmp(argv[i],"-shards")) {
+        if (++i == argc) goto missing;
+        shards = static_cast<unsigned int>(atoi(argv[i]));
+        if (shards == 0)
+          shards = 1;
       } else if (!strcmp(argv[i],"-iter")) {
         if (++i == argc) goto missing;
         iter = static_cast<unsigned int>(atoi(argv[i]));
@@ -226,8 +243,12 @@ main(int argc, char* argv[]) {
 
   bool started = startFrom == NULL ? true : false;
 
+  unsigned int t_idx = 0;
   for (Base* t = Base::tests() ; t != NULL; t = t->next() ) {
     try {
+      // Round-robin sharding for parallel test runs
+      if ((t_idx++ % opt.shards) != (opt.shard % opt.shards))
+        goto next;
       if (!started) {
         if (t->name().find(startFrom) != std::string::npos)
           started = true;
@@ -89,6 +89,10 @@ namespace Test {
     bool stop;
     /// Whether to log the tests
     bool log;
+    /// Which shard of the tests to run (for parallel runs)
+    unsigned int shard;
+    /// Over how many shards the tests are distributed (1 for all tests)
+    unsigned int shards;
 
     /// Initialize options with defaults
     Options(void);
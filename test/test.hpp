@@ -39,7 +39,8 @@ namespace Test {
    */
   inline
   Options::Options(void)
-    : seed(0), iter(defiter), fixprob(deffixprob), stop(true), log(false)
+    : seed(0), iter(defiter), fixprob(deffixprob), stop(true), log(false),
+      shard(0), shards(1)
   {}
 
   /*
@@ -40,6 +40,16 @@ using namespace Gecode;
 
 int main(int argc, char** argv) {
 
+  /*
+   * Solution printing must not throttle search: decouple from C
+   * stdio and give standard output a large buffer, so in
+   * all-solutions mode writes hit the operating system in big
+   * blocks instead of once per solution line.
+   */
+  std::ios_base::sync_with_stdio(false);
+  static char obuf[1024 * 1024];
+  std::cout.rdbuf()->pubsetbuf(obuf, sizeof(obuf));
+
   Support::Timer t_total;
   t_total.start();
   FlatZinc::FlatZincOptions opt("Gecode/FlatZinc");